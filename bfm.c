@@ -1,9 +1,27 @@
+#define _DEFAULT_SOURCE
+
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include <stdarg.h>
 #include <ctype.h>
+#include <limits.h>
 #include <assert.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#ifdef BFM_SUPEROPT
+#include <math.h>
+#endif
+
+#if defined(__x86_64__) && defined(__linux__)
+#define HAVE_JIT
+#include <sys/mman.h>
+#include <signal.h>
+#include <setjmp.h>
+#endif
 
 void check_errors();
 
@@ -14,8 +32,8 @@ int get_line_num(int);
 int get_column_num(int index);
 int count_leading_whitespace(int);
 char* get_line_from_index(int);
-void errprint(char*);
-void print_location(int);
+void errprint(FILE*, char*);
+void print_location(FILE*, int);
 void push_error(int errloc, int is_suppressable, int is_fatal, const char* message, ...);
 void list_errors();
 
@@ -29,6 +47,16 @@ void* bfm_malloc(size_t bytes)
 	return res;
 }
 
+void* bfm_calloc(size_t count, size_t size)
+{
+	void* res = calloc(count, size);
+
+	if (!res)
+		fatal_error(-1, "out of memory.");
+
+	return res;
+}
+
 void* bfm_realloc(void* block, size_t bytes)
 {
 	block = realloc(block, bytes);
@@ -39,6 +67,101 @@ void* bfm_realloc(void* block, size_t bytes)
 	return block;
 }
 
+/* data that lives as long as the compile (tokens, their values, macro argument
+ * lists, error messages) is bump allocated out of an arena's chunks and released
+ * all at once */
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+typedef struct ArenaChunk {
+	struct ArenaChunk* prev;
+	size_t size, used;
+	max_align_t data[];
+} ArenaChunk;
+
+typedef struct {
+	ArenaChunk* top;
+	long allocations;
+	size_t reserved, peak_reserved; /* bytes held in chunks */
+} Arena;
+
+Arena compile_arena = { 0 };
+
+#define ARENA_ROUND(bytes) (((bytes) + sizeof(max_align_t) - 1) / sizeof(max_align_t) * sizeof(max_align_t))
+
+void* arena_alloc(Arena* arena, size_t bytes)
+{
+	bytes = ARENA_ROUND(bytes);
+
+	if (!arena->top || arena->top->size - arena->top->used < bytes) {
+		/* big blocks get a chunk of their own */
+		size_t size = bytes > ARENA_CHUNK_SIZE ? bytes : ARENA_CHUNK_SIZE;
+		ArenaChunk* chunk = bfm_malloc(sizeof(ArenaChunk) + size);
+
+		chunk->prev = arena->top;
+		chunk->size = size;
+		chunk->used = 0;
+		arena->top = chunk;
+
+		arena->reserved += size;
+		if (arena->reserved > arena->peak_reserved)
+			arena->peak_reserved = arena->reserved;
+	}
+
+	void* block = (char*)arena->top->data + arena->top->used;
+	arena->top->used += bytes;
+	arena->allocations++;
+
+	return block;
+}
+
+/* like realloc, for blocks that only ever grow geometrically. the old copy of a
+ * block that can't be grown in place stays behind until the arena is released */
+void* arena_grow(Arena* arena, void* block, size_t old_bytes, size_t new_bytes)
+{
+	ArenaChunk* top = arena->top;
+	old_bytes = ARENA_ROUND(old_bytes), new_bytes = ARENA_ROUND(new_bytes);
+
+	if (!block)
+		return arena_alloc(arena, new_bytes);
+
+	/* the last block of the top chunk can take more of the chunk */
+	if ((char*)block >= (char*)top->data && (char*)block + old_bytes == (char*)top->data + top->used
+	    && (char*)block - (char*)top->data + new_bytes <= top->size) {
+		top->used = (char*)block - (char*)top->data + new_bytes;
+		return block;
+	}
+
+	/* a chunk holding nothing but the block is reallocated as a whole */
+	for (ArenaChunk** link = &arena->top; *link; link = &(*link)->prev) {
+		ArenaChunk* chunk = *link;
+		if ((void*)chunk->data != block || chunk->used != old_bytes)
+			continue;
+
+		arena->reserved = arena->reserved - chunk->size + new_bytes;
+		if (arena->reserved > arena->peak_reserved)
+			arena->peak_reserved = arena->reserved;
+
+		chunk = *link = bfm_realloc(chunk, sizeof(ArenaChunk) + new_bytes);
+		chunk->size = chunk->used = new_bytes;
+		return chunk->data;
+	}
+
+	void* grown = arena_alloc(arena, new_bytes);
+	memcpy(grown, block, old_bytes < new_bytes ? old_bytes : new_bytes);
+
+	return grown;
+}
+
+void arena_release(Arena* arena)
+{
+	while (arena->top) {
+		ArenaChunk* prev = arena->top->prev;
+		free(arena->top);
+		arena->top = prev;
+	}
+	arena->reserved = 0;
+}
+
 char* load_file(const char* path)
 {
 	char* buf = NULL;
@@ -93,8 +216,18 @@ typedef struct {
 	char* error;
 } Error;
 Error* errors = NULL;
+int errors_allocated = 0;
 
 char *raw = NULL, *input_path = NULL, *output_path = NULL;
+int run = 0, use_jit = 1, print_stats = 0, size_report = 0, check_algos = 0;
+
+/* cells wrap around at cell_mask + 1 */
+int cell_bits = 8;
+unsigned cell_mask = 255;
+
+enum {
+	TARGET_BF, TARGET_C
+} target = TARGET_BF;
 int num_errors;
 
 void check_errors()
@@ -180,31 +313,31 @@ char* get_line_from_index(int index)
 	return buf;
 }
 
-void errprint(char* str) /* when printing errors, the size of tabs can be an issue.
-                          * This prints a string with four spaces for tabs. */
+void errprint(FILE* file, char* str) /* when printing errors, the size of tabs can be an issue.
+                                      * This prints a string with four spaces for tabs. */
 {
 	size_t i;
 	for (i = 0; i < strlen(str); i++) {
 		if (str[i] == '\t')
-			printf("    ");
+			fputs("    ", file);
 		else if (str[i] != '\n')
-			putchar(str[i]);
+			fputc(str[i], file);
 	}
 }
 
-void print_location(int index)
+void print_location(FILE* file, int index)
 {
 	char* line = get_line_from_index(index);
 	
-	putchar('\t');
-	errprint(line);
-	printf("\n\t");
+	fputc('\t', file);
+	errprint(file, line);
+	fprintf(file, "\n\t");
 	
 	int i;
 	for (i = 0; i < get_column_num(index) - count_leading_whitespace(index); i++)
-		putchar(' ');
+		fputc(' ', file);
 	
-	printf("^\n");
+	fprintf(file, "^\n");
 }
 
 #define MAX_ERROR_LENGTH 512
@@ -231,33 +364,34 @@ void fatal_error(int errloc /* the location of the error */, const char* message
 	}
 	
 	if (errloc >= 0) /* if errloc is positive we will print out the line that caused the error */
-		print_location(errloc);
+		print_location(stdout, errloc);
 	
 	exit(EXIT_FAILURE);
 }
 
 void push_error(int errloc /* the location of the error */, int is_suppressable, int is_fatal, const char* message, ...)
 {
-	if (!errors) {
-		errors = bfm_malloc(sizeof(Error));
-	} else {
-		errors = bfm_realloc(errors, (num_errors + 1) * sizeof(Error));
+	if (num_errors == errors_allocated) {
+		errors_allocated = errors_allocated ? 2 * errors_allocated : 16;
+		errors = arena_grow(&compile_arena, errors, num_errors * sizeof(Error), errors_allocated * sizeof(Error));
 	}
 
-	errors[num_errors].errloc = errloc;
-	errors[num_errors].is_suppressable = is_suppressable;
-	errors[num_errors].is_fatal = is_fatal;
-	errors[num_errors].error = bfm_malloc(MAX_ERROR_LENGTH + 1);
-	errors[num_errors].error[0] = 0;
+	char error_buf[MAX_ERROR_LENGTH + 1];
+	error_buf[0] = 0;
 	
 	if (message) {
 		va_list args;
 		va_start(args, message);
 		
-		vsnprintf(errors[num_errors].error, MAX_ERROR_LENGTH, message, args);
+		vsnprintf(error_buf, MAX_ERROR_LENGTH, message, args);
 		
 		va_end(args);
 	}
+
+	errors[num_errors].errloc = errloc;
+	errors[num_errors].is_suppressable = is_suppressable;
+	errors[num_errors].is_fatal = is_fatal;
+	errors[num_errors].error = strcpy(arena_alloc(&compile_arena, strlen(error_buf) + 1), error_buf);
 	
 	num_errors++;
 }
@@ -287,18 +421,18 @@ void list_errors()
 			printf("warning: ");
 		}
 
-		errprint(error);
+		errprint(stdout, error);
 		putchar('\n');
 		
 		if (errloc >= 0) /* if errloc is positive we will print out the line that caused the error */
-			print_location(errloc);
+			print_location(stdout, errloc);
 	}
 
 	if (!verbose)
 		printf("\tnote: %d warning(s) suppressed.\n", suppressed_count);
 }
 
-#define NUM_KEYWORDS 14
+#define NUM_KEYWORDS 17
 char keywords[NUM_KEYWORDS][15] = {
 	"var",
 	"while",
@@ -313,7 +447,10 @@ char keywords[NUM_KEYWORDS][15] = {
 	"input",
 	"write",
 	"decimal",
-	"macro"
+	"macro",
+	"fill",
+	"var16",
+	"var32"
 };
 
 enum {
@@ -330,15 +467,32 @@ enum {
 	KYWRD_INPUT,
 	KYWRD_WRITE,
 	KYWRD_DECIM,
-	KYWRD_MACRO
+	KYWRD_MACRO,
+	KYWRD_FILL,
+	KYWRD_VAR16,
+	KYWRD_VAR32
 };
 
-int get_keyword(char* str)
+/* keywords are found with a perfect hash of their length and their second
+ * and last characters, which no two of them share */
+#define KEYWORD_HASH(str, len) ((3 * (len) + 4 * (str)[1] + 5 * (str)[(len) - 1]) & 31)
+signed char keyword_table[32];
+
+void init_keyword_table()
 {
+	memset(keyword_table, -1, sizeof(keyword_table));
 	for (int i = 0; i < NUM_KEYWORDS; i++)
-		if (!strcmp(str, keywords[i]))
-			return i;
-	return -1;
+		keyword_table[KEYWORD_HASH(keywords[i], (int)strlen(keywords[i]))] = i;
+}
+
+int get_keyword(char* str)
+{
+	int len = strlen(str);
+	if (len < 2 || len > 14)
+		return -1;
+
+	int i = keyword_table[KEYWORD_HASH(str, len)];
+	return i >= 0 && !strcmp(str, keywords[i]) ? i : -1;
 }
 
 typedef struct struct_token {
@@ -349,10 +503,11 @@ typedef struct struct_token {
 		TOK_KYWRD
 	} type;
 
-	int origin, data; /* the index of the token's original location in the source file */
-	char* value; /* the body of the token */
+	int origin; /* the index of the token's original location in the source file */
+	long long data; /* a number's value, a string's length, or which keyword or operator it is */
+	char* value; /* the body of the token, in the buffer all token text shares */
 	
-	struct struct_token* next; /* all tokens are part of a linked list */
+	struct struct_token* next; /* the tokens are one array, linked to their neighbours in it */
 	struct struct_token* prev;
 } Token;
 
@@ -433,12 +588,11 @@ int is_hex_num(char* str)
 	return 1;
 }
 
+/* escapes are replaced where they are, as they never get longer */
 int parse_escape_characters(char* str, int location)
 {
-	char* buf = bfm_malloc(strlen(str) + 1);
-	
 	int i = 0;
-	char* c = buf;
+	char* c = str;
 	while (str[i]) {
 		if (str[i] == '\\') {
 			i++;
@@ -461,7 +615,7 @@ int parse_escape_characters(char* str, int location)
 						push_error(location + i, 1, 1, "malformed escape sequence.");
 
 					*c = (char)strtol(num, NULL, 16);
-					i += 2;
+					i += strlen(num);
 					break;
 				default:
 					*c = str[i];
@@ -474,21 +628,34 @@ int parse_escape_characters(char* str, int location)
 			c++;
 		}
 		
-		i++;
+		if (str[i])
+			i++;
 	}
 	*c = '\0';
-	memcpy(str, buf, (c - buf) + 1);
-	free(buf);
 
-	return (int)(c - buf);
+	return (int)(c - str);
 }
 
 int get_operator_type(const char* str)
 {
-	int i;
-	for (i = 0; i < NUM_OPERATORS; i++) {
-		if (!strncmp(operators[i], str, strlen(operators[i])))
-			return i;
+	switch (str[0]) {
+		case '=': return str[1] == '=' ? MOP_EQUEQU : MOP_EQU;
+		case '!': return str[1] == '=' ? MOP_NEQU : MOP_EX;
+		case '&': return str[1] == '&' ? MOP_ANDAND : -1;
+		case '|': return str[1] == '|' ? MOP_OROR : -1;
+		case '+': return str[1] == '=' ? MOP_ADDEQU : str[1] == '+' ? MOP_ADDADD : MOP_ADD;
+		case '-': return str[1] == '=' ? MOP_SUBEQU : str[1] == '-' ? MOP_SUBSUB : MOP_SUB;
+		case '*': return str[1] == '=' ? MOP_MULEQU : MOP_MUL;
+		case '/': return str[1] == '=' ? MOP_DIVEQU : MOP_DIV;
+		case '%': return str[1] == '=' ? MOP_MODEQU : MOP_MOD;
+		case '>': return str[1] == '=' ? MOP_GEQU : MOP_MORE;
+		case '<': return str[1] == '=' ? MOP_LEQU : MOP_LESS;
+		case '(': return MOP_LBRACE;
+		case ')': return MOP_RBRACE;
+		case ';': return MOP_SEMICOLON;
+		case '[': return MOP_LBRACK;
+		case ']': return MOP_RBRACK;
+		case ',': return MOP_COMMA;
 	}
 	
 	return -1;
@@ -504,265 +671,307 @@ char token_types[][11] = {
 };
 #endif
 
-Token* tokenize(char* in)
+/* identifiers are interned as they're scanned, so that names can be
+ * compared by pointer. the first token with a name holds it for all. */
+char** interned = NULL;
+int num_interned = 0, interned_allocated = 0;
+
+unsigned hash_string(const char* str)
 {
-	Token* current = NULL, *head = NULL, *prev = NULL;
-	char * start   = in, *end = in;
+	unsigned hash = 2166136261u;
+	while (*str)
+		hash = (hash ^ (unsigned char)*str++) * 16777619u;
+	return hash;
+}
 
-	/* end will march ahead of start to the end of a token, then
-	start will walk to end. repeat. (like an inchworm walking
-	along the string) */
+char* intern(char* str)
+{
+	if (2 * (num_interned + 1) > interned_allocated) {
+		char** old = interned;
+		int old_allocated = interned_allocated;
 
-	int skip_char = 0, tok_type = -1, tok_origin = -1;
-	
-	while (*end != '\0') {
-		/* whitespace is meaningless in this language,
-                   it shouldn't be tokenized. */
-		while (isspace(*start) && *start) {
-			start++;
-			end++;
-		}
-		tok_origin = start - in;
-		
-		if (!strncmp(start, "*/", 2)) {
-			push_error(tok_origin, 0, 1, "comment terminator has no intializer.");
-			
-			start += 2;
-			end = start;
-			tok_origin = start - in;
-		}
-
-		/* skip multi-line comments by scanning for the
-                 * terminator */
-		if (!strncmp(start, "/*", 2)) {
-			/* we will allow comments within comments,
-			 * so we have to keep track of how many comments
-			 * are embedded, so we know when we've reached
-			 * the _actual_ comment terminator. */
-			int comment_depth = 1;
-			end += 2;
-
-			/* when comment_depth is zero we have matched
-			 * all comment initializers */
-			while (comment_depth > 0 && *end) {
-				end++;
-				if (!strncmp(end, "/*", 2))
-					comment_depth++;
-				if (!strncmp(end, "*/", 2))
-					comment_depth--;
-			}
-			
-			if (comment_depth || !*end) {
-				push_error(tok_origin, 0, 1, "unterminated comment.");
-				
-				start += 2;
-				end = start;
-				tok_origin = start - in;
-			}
-			
-			end += 2;
-			start = end;
-			continue;
-		} else if (!strncmp(start, "//", 2)) { /* skip single line comments by scanning for newline or NUL */
-			end += 2;
-			while (strncmp(end, "\n", 1) && *end) end++;
-			start = end;
-			continue;
+		interned_allocated = interned_allocated ? 2 * interned_allocated : 1024;
+		interned = memset(arena_alloc(&compile_arena, interned_allocated * sizeof(char*)), 0, interned_allocated * sizeof(char*));
+
+		for (int i = 0; i < old_allocated; i++) {
+			if (!old[i])
+				continue;
+
+			unsigned slot = hash_string(old[i]) & (interned_allocated - 1);
+			while (interned[slot])
+				slot = (slot + 1) & (interned_allocated - 1);
+			interned[slot] = old[i];
 		}
-		
-		start = end;
-		
-		while (isspace(*start) && *start) /* skip any more whitespace */
-			start++;
-		
-		if (!*start)
-			break; /* there was whitespace at the end of the file, don't try to tokenize the void */
-		
-		end = start;
-		tok_origin = start - in;
-		skip_char = 0;
-		
-		/* main tokenization */
-		if (get_operator_type(start) >= 0) {
-			tok_type = TOK_OPERATOR;
-			end += strlen(operators[get_operator_type(start)]);
-		} else if (is_legal_in_identifer(*start)) {
-			tok_type = TOK_IDENTIFIER;
-			while (is_legal_in_identifer(*end)) end++;
-		} else if (*start == '"') {
-			skip_char = 1;
-			
-			end++;
-			start++;
-			
-			tok_type = TOK_STRING;
-			while (*end != '"' && *end) {
-				if (*end == '\n') {
-					push_error(tok_origin, 0, 1, "unmatched \" character.");
-					
-					start += 1;
-					end = start;
-					tok_origin = start - in;
-					
-					break;
+	}
+
+	unsigned slot = hash_string(str) & (interned_allocated - 1);
+	while (interned[slot]) {
+		if (!strcmp(interned[slot], str))
+			return interned[slot];
+		slot = (slot + 1) & (interned_allocated - 1);
+	}
+
+	num_interned++;
+	return interned[slot] = str;
+}
+
+/* the lexer decides what to scan from the class of a token's first character */
+enum {
+	CHAR_OTHER, CHAR_SPACE,
+	CHAR_IDENT, CHAR_OPERATOR,
+	CHAR_QUOTE
+};
+
+unsigned char char_classes[256];
+
+void init_char_classes()
+{
+	for (int c = 0; c < 256; c++) {
+		if (isspace(c))
+			char_classes[c] = CHAR_SPACE;
+		else if (is_legal_in_identifer(c))
+			char_classes[c] = CHAR_IDENT;
+		else if (c && strchr("=!&|+-*/%<>();[],", c))
+			char_classes[c] = CHAR_OPERATOR;
+		else if (c == '"' || c == '\'')
+			char_classes[c] = CHAR_QUOTE;
+		else
+			char_classes[c] = CHAR_OTHER;
+	}
+}
+
+Token* tokenize(char* in)
+{
+	Token* tokens = NULL;
+	int num_tokens = 0, allocated = 0;
+	size_t length = strlen(in);
+
+	/* a token's value is never longer than its source, so with a terminator
+	 * for each the values fit in twice the source */
+	char* text = arena_alloc(&compile_arena, 2 * length + 2);
+	char* s = in;
+
+	init_char_classes();
+	init_keyword_table();
+
+	while (*s) {
+		int origin = s - in, type, len;
+		char* start = s;
+
+		switch (char_classes[(unsigned char)*s]) {
+			case CHAR_SPACE:
+				s++;
+				continue;
+			case CHAR_IDENT:
+				while (char_classes[(unsigned char)*s] == CHAR_IDENT)
+					s++;
+				type = TOK_IDENTIFIER;
+				break;
+			case CHAR_OPERATOR:
+				if (s[0] == '/' && s[1] == '/') {
+					while (*s && *s != '\n')
+						s++;
+					continue;
 				}
-				else {
-					if (*end == '\\' && *(end + 1) != 0)
-						end++;
-					end++;
+
+				/* comments may be nested within comments */
+				if (s[0] == '/' && s[1] == '*') {
+					int comment_depth = 1;
+					s += 2;
+					while (comment_depth && *s) {
+						if (s[0] == '/' && s[1] == '*')
+							comment_depth++, s += 2;
+						else if (s[0] == '*' && s[1] == '/')
+							comment_depth--, s += 2;
+						else
+							s++;
+					}
+
+					if (comment_depth)
+						push_error(origin, 0, 1, "unterminated comment.");
+					continue;
 				}
-			}
-			
-			if (!*end) {
-				push_error(tok_origin, 0, 1, "unmatched \" character.");
-				
-				start += 1;
-				end = start;
-				tok_origin = start - in;
-			}
-		} else if (*start == '\'') {
-			skip_char = 1;
-			
-			end++;
-			start++;
-			
-			tok_type = TOK_CHAR;
-			while (*end != '\'' && *end) {
-				if (*end == '\n') {
-					push_error(tok_origin, 0, 1, "unmatched ' character.");
-					
-					start += 1;
-					end = start;
-					tok_origin = start - in;
-					
+
+				if (s[0] == '*' && s[1] == '/') {
+					push_error(origin, 0, 1, "comment terminator has no intializer.");
+					s += 2;
+					continue;
+				}
+
+				if (get_operator_type(s) < 0) {
+					s++;
+					type = TOK_SYMBOL;
 					break;
 				}
-				else {
-					if (*end == '\\' && *(end + 1) != 0)
-						end++;
-					end++;
+
+				s += strlen(operators[get_operator_type(s)]);
+				type = TOK_OPERATOR;
+				break;
+			case CHAR_QUOTE: {
+				char quote = *s++;
+				start = s;
+				type = quote == '"' ? TOK_STRING : TOK_CHAR;
+
+				while (*s != quote && *s && *s != '\n') {
+					if (*s == '\\' && s[1])
+						s++;
+					s++;
 				}
-			}
-			
-			if (!*end) {
-				push_error(tok_origin, 0, 1, "unmatched ' character.");
-				
-				start += 1;
-				end = start;
-				tok_origin = start - in;
-			}
-		} else {
-			tok_type = TOK_SYMBOL;
-			end++;
-		}
-		
-		if (!current)
-			current = bfm_malloc(sizeof(Token));
 
-		current->prev   = prev;
-		current->type   = tok_type;
-		current->origin = tok_origin;
-		current->value  = bfm_malloc(end - start + 1);
-		
-		int i = 0;
-		while (start < end) { /* walk start until it catches up with end */
-			current->value[i] = *start;
-			start++;
-			i++;
-		}
-		current->value[i] = 0;
-		
-		if (current->type == TOK_IDENTIFIER) {
-			if (is_number(current->value)) {
-				current->type = TOK_NUMBER;
-			} else if (get_keyword(current->value) != -1) {
-				current->type = TOK_KYWRD;
-				current->data = get_keyword(current->value);
-			}
-		}
-		
-		if (current->type == TOK_OPERATOR) {
-			current->data = get_operator_type(current->value);
+				if (*s != quote)
+					push_error(origin, 0, 1, quote == '"' ? "unmatched \" character." : "unmatched ' character.");
+			} break;
+			default:
+				s++;
+				type = TOK_SYMBOL;
+				break;
 		}
 
-		if (current->type == TOK_STRING || current->type == TOK_CHAR) {
-			current->data = parse_escape_characters(current->value, current->origin);
+		if (num_tokens == allocated) {
+			allocated = allocated ? 2 * allocated : 1024;
+			tokens = arena_grow(&compile_arena, tokens, num_tokens * sizeof(Token), allocated * sizeof(Token));
 		}
 
-		if (current->type == TOK_NUMBER) {
-			current->data = strtol(current->value, NULL, 0);
+		Token* current = &tokens[num_tokens++];
+		len = s - start;
+		memcpy(text, start, len);
+		text[len] = '\0';
+
+		current->type   = type;
+		current->origin = origin;
+		current->value  = text;
+		current->data   = 0;
+		text += len + 1;
+
+		if (type == TOK_STRING || type == TOK_CHAR) {
+			if (*s)
+				s++; /* the closing quote */
+			current->data = parse_escape_characters(current->value, origin);
 		}
 
-		if (current->type == TOK_CHAR) {
+		if (type == TOK_IDENTIFIER) {
+			if (isdigit((unsigned char)*start) && is_number(current->value)) {
+				current->type = TOK_NUMBER;
+				current->data = strtoll(current->value, NULL, 0);
+			} else if ((current->data = get_keyword(current->value)) != -1) {
+				current->type = TOK_KYWRD;
+			} else {
+				current->data = 0;
+				current->value = intern(current->value);
+			}
+		} else if (type == TOK_OPERATOR) {
+			current->data = get_operator_type(current->value);
+		} else if (type == TOK_CHAR) {
 			if (strlen(current->value) > 1) {
-				push_error(tok_origin, 0, 1, "multi-character chars are not permitted.");
+				push_error(origin, 0, 1, "multi-character chars are not permitted.");
 			}
 
 			current->type = TOK_NUMBER;
 			current->data = (int)(current->value[0]);
 		}
-		
-		prev = current;
-		current->next = bfm_malloc(sizeof(Token));
-		current = current->next;
-		
-		if (skip_char) {
-			end++;
-			start++;
-		}
 	}
-	
-	if (current)
-		free(current); 
 
-	head = prev;
-	if (head) {
-		prev->next = NULL;
-
-		while (head->prev) {
-			head = head->prev;
-		}
+	/* the array doesn't move any more, so the links can be made */
+	for (int i = 0; i < num_tokens; i++) {
+		tokens[i].prev = i ? &tokens[i - 1] : NULL;
+		tokens[i].next = i + 1 < num_tokens ? &tokens[i + 1] : NULL;
 	}
 
-	return head;
+	return num_tokens ? tokens : NULL;
 }
 
-#define OUT_GROWTH_SPEED 4096
-char *output;
-int out_index = 0, out_allocated = 0;
+#define IS_BF_COMMAND(c) (   \
+        c == '<' || c == '>'     \
+        || c == '+' || c == '-'  \
+        || c == '[' || c == ']'  \
+        || c == ',' || c == '.')
+
+/* the code generator doesn't produce text directly, it appends run-length
+ * records to this vector. the text is only rendered once compilation is
+ * finished. */
+typedef struct {
+	char op;   /* one of the eight brainfuck commands */
+	int count; /* how many times the command is repeated */
+
+	int origin;    /* the statement that emitted the instruction */
+	int expansion; /* the macro expansion the statement was part of */
+} Instruction;
+
+#define CODE_GROWTH_SPEED 4096
+Instruction* code = NULL;
+int code_len = 0, code_allocated = 0, current_origin = -1, current_expansion = -1;
 
 void reset_emit()
 {
-	if (output)
-		free(output);
-	
-	output = bfm_malloc(128 /* arbitrary number */);
-	out_allocated = 128;
-	out_index = 0;
-	
-	output[0] = '\0';
+	if (code)
+		free(code);
+
+	code = bfm_malloc(CODE_GROWTH_SPEED * sizeof(Instruction));
+	code_allocated = CODE_GROWTH_SPEED;
+	code_len = 0;
+}
+
+void track_op(char op, int count);
+
+void emit_op(char op, int count)
+{
+	if (count <= 0)
+		return;
+
+	if (!code) reset_emit();
+
+	track_op(op, count);
+
+	/* brackets can't be run-length encoded, everything else can */
+	if (code_len && code[code_len - 1].op == op && op != '[' && op != ']'
+	    && code[code_len - 1].count <= INT_MAX - count
+	    && code[code_len - 1].origin == current_origin
+	    && code[code_len - 1].expansion == current_expansion) {
+		code[code_len - 1].count += count;
+		return;
+	}
+
+	/* doubling keeps emitting linear in the size of the output */
+	if (code_len == code_allocated) {
+		code_allocated *= 2;
+		code = bfm_realloc(code, code_allocated * sizeof(Instruction));
+	}
+
+	code[code_len].op = op;
+	code[code_len].origin = current_origin;
+	code[code_len].expansion = current_expansion;
+	code[code_len++].count = count;
 }
 
 void emit(const char* out)
 {
-	if (!output) reset_emit();
-	
-	int bytes_needed = strlen(out) + out_index - out_allocated;
-	if (bytes_needed >= 0) {
-		output = bfm_realloc(output, out_allocated + bytes_needed + OUT_GROWTH_SPEED);
-		out_allocated = out_allocated + bytes_needed + OUT_GROWTH_SPEED;
+	while (*out) {
+		if (IS_BF_COMMAND(*out))
+			emit_op(*out, 1);
+		out++;
 	}
-	
-	strcpy(&output[out_index], out);
-	out_index += strlen(out);
 }
 
 void emit_char(char c)
 {
-	char buf[2] = { 0 };
-	buf[0] = c;
-	
-	emit(buf);
+	if (IS_BF_COMMAND(c))
+		emit_op(c, 1);
+}
+
+char* render_code(Instruction* instr, int len)
+{
+	size_t bytes = 0;
+	for (int i = 0; i < len; i++)
+		bytes += instr[i].count;
+
+	char* buf = bfm_malloc(bytes + 1), *c = buf;
+	for (int i = 0; i < len; i++) {
+		memset(c, instr[i].op, instr[i].count);
+		c += instr[i].count;
+	}
+	*c = '\0';
+
+	return buf;
 }
 
 #define IS_DIGIT(c) \
@@ -778,1479 +987,5538 @@ void emit_char(char c)
         while (!IS_BF_COMMAND(*c) && *c) c++; \
     } while (0);
 
-void sanitize(char* str)
+enum {
+	RULE_ADD, RULE_MOVE, RULE_DEAD_LOOP,
+	RULE_ZERO_LOOP, RULE_REINIT
+};
+
+#define NUM_RULES 5
+char rule_names[NUM_RULES][32] = {
+	"+/- cancellation",
+	"</> cancellation",
+	"dead loop removal",
+	"known zero loop removal",
+	"known value reinitialization"
+};
+long bytes_removed[NUM_RULES];
+
+char opposite_op(char op)
 {
-	if (!str)
-		return;
+	switch (op) {
+		case '+': return '-';
+		case '-': return '+';
+		case '>': return '<';
+		case '<': return '>';
+	}
+	return 0;
+}
 
-#define IS_BF_COMMAND(c) (   \
-        c == '<' || c == '>'     \
-        || c == '+' || c == '-'  \
-        || c == '[' || c == ']'  \
-        || c == ',' || c == '.')
+/* a single pass peephole optimizer. the output is kept as a stack in the
+ * front of the same buffer, so whenever an instruction is cancelled out the
+ * instruction below it is exposed again and can combine with whatever comes
+ * next. this reaches the same fixpoint as repeatedly rescanning the code. */
+int optimize(Instruction* instr, int len)
+{
+	int top = 0; /* the number of instructions on the output stack */
+
+	for (int i = 0; i < len; i++) {
+		char op = instr[i].op;
+		int count = instr[i].count;
+
+		if (op == '[' && top && instr[top - 1].op == ']') {
+			/* the cell must be zero after a loop, so this one can't run */
+			int depth = 0;
+			for (; i < len; i++) {
+				bytes_removed[RULE_DEAD_LOOP] += instr[i].count;
+				if (instr[i].op == '[') depth++;
+				else if (instr[i].op == ']' && !--depth) break;
+			}
+			continue;
+		}
 
-#define ADD(a, c) \
-        if (a >= 0) { \
-                for (int counter = 0; counter < abs(a); counter++) { \
-                        *c++ = '+'; \
-                } \
-        } else { \
-    	        for (int counter = 0; counter < abs(a); counter++) { \
-                        *c++ = '-'; \
-                } \
-        }
-
-#define MOVE_PTR(a, c) \
-    if (a >= 0) { \
-        for (int counter = 0; counter < abs(a); counter++) { \
-            *c++ = '>'; \
-        } \
-    } else { \
-    	for (int counter = 0; counter < abs(a); counter++) { \
-            *c++ = '<'; \
-        } \
-    }
-
-#define IS_CONTRACTABLE(c) (     \
-        c == '<' || c == '>'     \
-        || c == '+' || c == '-')
+		char opposite = opposite_op(op);
+		int rule = (op == '+' || op == '-') ? RULE_ADD : RULE_MOVE;
 
-	char* buf = bfm_malloc(strlen(str) + 1);
+		while (opposite && count && top && instr[top - 1].op == opposite) {
+			int cancelled = count < instr[top - 1].count ? count : instr[top - 1].count;
 
-	size_t starting_len;
-	char* i, *out;
+			count -= cancelled;
+			bytes_removed[rule] += 2 * cancelled;
 
-	starting_len = strlen(str);
-	i = str, out = buf;
+			if (!(instr[top - 1].count -= cancelled))
+				top--;
+		}
 
-	while (*i != '\0') {
-		if (IS_CONTRACTABLE(*i)) {
-			if (*i == '+' || *i == '-') {
-				int sum = 0;
-				while (*i == '+' || *i == '-') {
-					if (*i == '+') sum++;
-					else sum--;
-					i++;
-				}
-				ADD(sum, out)
-			} else {
-				int sum = 0;
-				while (*i == '>' || *i == '<') {
-					if (*i == '>') sum++;
-					else sum--;
-					i++;
-				}
-				MOVE_PTR(sum, out)
-			}
-		} else if (!strncmp(i, "][", 2)) {
-			i += 2;
-			int depth = 1;
-			while (*i != '\0' && depth) {
-				if (*i == '[') depth++;
-				else if (*i == ']') depth--;
-				i++;
-			}
-			i--;
-		} else if (IS_BF_COMMAND(*i)) {
-			*out++ = *i++;
+		if (!count)
+			continue;
+
+		if (top && instr[top - 1].op == op && op != '[' && op != ']') {
+			instr[top - 1].count += count;
 		} else {
-			i++;
+			instr[top] = instr[i];
+			instr[top++].count = count;
 		}
 	}
-	*out = '\0';
-	strcpy(str, buf);
-	free(buf);
 
-	if (strlen(str) < starting_len) {
-		sanitize(str);
+	return top;
+}
+
+int* match_brackets(Instruction* instr, int len)
+{
+	int* match = bfm_malloc((len + 1) * sizeof(int)), *stack = bfm_malloc((len + 1) * sizeof(int));
+	int sp = 0;
+
+	for (int i = 0; i < len; i++) {
+		if (instr[i].op == '[') {
+			stack[sp++] = i;
+		} else if (instr[i].op == ']') {
+			if (!sp) { /* a ] without a [ is unbalanced too */
+				sp = 1;
+				break;
+			}
+			match[i] = stack[--sp];
+			match[match[i]] = i;
+		}
+	}
+
+	free(stack);
+
+	if (sp) { /* someone wrote unbalanced code with the fuck keyword */
+		free(match);
+		return NULL;
 	}
+
+	return match;
 }
 
-#define NUM_TEMP_CELLS 7
-int cell_pointer = 0, temp_cells = 0, temp_x = 0, temp_x_index = 0, temp_y = 0, temp_y_index = 0,
-	arrays = 0, if_cell;
+/* what an abstract interpretation of the code knows about a cell */
+typedef struct {
+	int known;
+	unsigned value;
+} CellState;
 
-void move_pointer(int distance)
+/* what it knows about the whole tape. the cells are stored from base on, so
+ * that the pointer can move to the left of where the interpretation began */
+typedef struct {
+	CellState* cells;
+	int base, allocated, known_by_default;
+	int pos; /* where the pointer is */
+} CellStates;
+
+CellState* get_cell_state(CellStates* states, int pos)
 {
-	cell_pointer += distance;
-	int i;
-	if (distance > 0)
-		for (i = 0; i < distance; i++)
-			emit(">");
-	else
-		for (i = 0; i > distance; i--)
-			emit("<");
+	if (pos < states->base || pos >= states->base + states->allocated) {
+		int low = pos < states->base ? pos - 64 : states->base;
+		int high = pos >= states->base + states->allocated ? pos + 64 : states->base + states->allocated;
+
+		if (!states->allocated)
+			low = pos - 64, high = pos + 64;
+
+		CellState* cells = bfm_malloc((high - low) * sizeof(CellState));
+		for (int i = 0; i < high - low; i++) {
+			cells[i].known = states->known_by_default;
+			cells[i].value = 0;
+		}
+
+		if (states->allocated) {
+			memcpy(&cells[states->base - low], states->cells, states->allocated * sizeof(CellState));
+			free(states->cells);
+		}
+
+		states->cells = cells;
+		states->base = low;
+		states->allocated = high - low;
+	}
+
+	return &states->cells[pos - states->base];
 }
 
-void move_pointer_to(int position)
+void forget_cells(CellStates* states, int known_by_default)
 {
-	int cells_to_move = position - cell_pointer;
-	move_pointer(cells_to_move);
+	states->known_by_default = known_by_default;
+	for (int i = 0; i < states->allocated; i++) {
+		states->cells[i].known = known_by_default;
+		states->cells[i].value = 0;
+	}
 }
 
-enum {
-	ALGO_DIV, ALGO_MUL,
-	ALGO_ADD, ALGO_SUB,
-	ALGO_EQU, ALGO_MOD,
-	ALGO_GRT, ALGO_NOT,
-	ALGO_CEQU, ALGO_ARRAY_WRITE,
-	ALGO_ARRAY_READ, ALGO_PRINTV,
-	ALGO_OR, ALGO_DECIM,
-	ALGO_AND, ALGO_LESS
-};
-
-#define NUM_ALGORITHMS 16
-char algorithms[NUM_ALGORITHMS][256] = {
-	"0[-]1[-]2[-]3[-]x[0+x-]0[y[1+2+y-]2[y+2-]1[2+0-[2[-]3+0-]3[0+3-]2[1-[x-1[-]]+2-]1-]x+0]", /* x / y */
-	"0[-]1[-]x[1+x-]1[y[x+0+y-]0[y+0-]1-]", /* x * y */
-	"0[-]y[x+0+y-]0[y+0-]", /* x + y */
-	"0[-]y[x-0+y-]0[y+0-]", /* x - y */
-	"0[-]x[-]y[x+0+y-]0[y+0-]", /* x = y */
-	"1[-]2[-]3[-]4[-]5[-]6[-]x[1+x-]y[2+3+y-]3[y+3-]1[>->+<[>]>[<+>-]<<[<]>-]3[x+3-]x", /* x % y */
-	"0[-]1[-]2[-]5[-]6[-]y[5+6+y-]6[y+6-]x[0+y[-0[-]1+y]0[-2+0]1[-y+1]y-x-]2[x+2-]y[-]5[y+5-]", /* x > y */
-	"0[-]x[0+x[-]]+0[x-0-]", /* logical not */
-	"0[-]1[-]x[1+x-]+y[1-0+y-]0[y+0-]1[x-1[-]]", /* x == y */
-	"z[-x+x>>>+<<<z]x[-z+x]y[-x+x>+<y]x[-y+x]y[-x+x>>+<<y]x[-y+x]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<", /* x(y) = z (array write) */
-	"z[-y+y>+<z]y[-z+y]z[-y+y>>+<<z]y[-z+y]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<x[-]y>>>[-<<<x+y>>>]<<<", /* x = y(z) (array read) */
-	"0[-]1[-]2[-]3[-]4[-]5[-]6[-]7[-]x[0+1+x-]1[x+1-]0[>>+>+<<<-]>>>[<<<+>>>-]<<+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<", /* printv */
-	"0[-]1[-]x[1+x-]1[x-1[-]]y[1+0+y-]0[y+0-]1[x[-]-1[-]]", /* logical or */
-	"0[-]>[-]+[[-]>[-],[+[-----------[>[-]++++++[<------>-]<--<<[->>++++++++++<<]>>[-<<+>>]<+>]]]<]<0[x+0-]", /* decimal input */
-	"0[-]1[-]x[1+x-]1[1[-]y[1+0+y-]0[y+0-]1[x+1[-]]]", /* logical and */
-	
-	// this algoritm is from http://stackoverflow.com/a/13327857
-	// it fails if x is 255, it should be replaced
-	"0[-]1[-]+2[-]3[-]x[3+x-]4[-]5[-]y[4+5+y-]5[y+5-]3+>+<[->-[>]<<]<[-]<[-<>>>x+0]", /* x < y */
-};
+/* the effect of a single instruction other than a loop */
+void interpret_op(CellStates* states, char op, int count)
+{
+	CellState* cell = get_cell_state(states, states->pos);
+
+	switch (op) {
+		case '>': states->pos += count; break;
+		case '<': states->pos -= count; break;
+		case '+': cell->value = (cell->value + count) & cell_mask; break;
+		case '-': cell->value = (cell->value - count) & cell_mask; break;
+		case ',': cell->known = 0; break;
+	}
+}
 
-void emit_algo(int algo, int x, int y, int z)
+/* marks every cell that the loop between instr[start] and instr[end] could
+ * change or learn something about as unknown. returns 0 if the pointer
+ * doesn't always come back to where the loop started, in which case nothing
+ * is known about anything. */
+int forget_loop_cells(CellStates* states, Instruction* instr, int start, int end)
 {
-	int i = 0;
-	while (algorithms[algo][i] != '\0') {
-		if (IS_BF_COMMAND(algorithms[algo][i])) {
-			emit_char(algorithms[algo][i]);
-		} else {
-			switch (algorithms[algo][i]) {
-				case 'x': move_pointer_to(x); break;
-				case 'y': move_pointer_to(y); break;
-				case 'z': move_pointer_to(z); break;
-				default: move_pointer_to(temp_cells + (algorithms[algo][i] - '0')); break;
-			}
+	int offset = 0, depth = 0, *offsets = bfm_malloc((end - start + 1) * sizeof(int));
+
+	for (int i = start + 1; i < end; i++) {
+		switch (instr[i].op) {
+			case '>': offset += instr[i].count; break;
+			case '<': offset -= instr[i].count; break;
+			case '+': case '-': case ',': get_cell_state(states, states->pos + offset)->known = 0; break;
+			case '[':
+				offsets[depth++] = offset;
+				get_cell_state(states, states->pos + offset)->known = 0;
+				break;
+			case ']':
+				get_cell_state(states, states->pos + offset)->known = 0;
+				if (!depth || offsets[--depth] != offset) {
+					free(offsets);
+					return 0;
+				}
+				break;
 		}
-		i++;
 	}
+
+	free(offsets);
+	return offset == 0;
 }
 
-void add(int amount)
+/* leaving a loop, the body might have run any number of times, including
+ * none, but the cell under the pointer is zero. returns whether the loop is
+ * balanced. */
+int leave_loop(CellStates* states, Instruction* instr, int start, int end)
 {
-	int i;
-	
-	if (amount > 0)
-		for (i = 0; i < amount; i++) emit("+");
-	else
-		for (i = 0; i > amount; i--) emit("-");
+	int balanced = forget_loop_cells(states, instr, start, end);
+	if (!balanced)
+		forget_cells(states, 0); /* we have no idea where the pointer is anymore */
+
+	CellState* cell = get_cell_state(states, states->pos);
+	cell->known = 1, cell->value = 0;
+
+	return balanced;
 }
 
-void emit_print_string(Token* tok)
+/* the shortest way to add amount to a cell, negative when it's quicker to
+ * subtract */
+long long shortest_add(long long amount)
 {
-	move_pointer_to(temp_cells);
-	emit("[-]"), add(tok->value[0]), emit(".");
-	
-	for (int i = 1; i < tok->data; i++) {
-		add(tok->value[i] - tok->value[i - 1]);
-		emit(".");
-	}
+	unsigned long long wrapped = amount & cell_mask;
+	return wrapped > cell_mask / 2 + 1 ? -(long long)(cell_mask - wrapped + 1) : (long long)wrapped;
 }
 
-void emit_write_string(Token* tok)
+long long cheapest_add(long long amount)
 {
-	emit("[-]"), add(tok->value[0]);
+	return llabs(shortest_add(amount));
+}
 
-	if (tok->data) {
-		int i;
-		for (i = 1; i < tok->data - 1; i++) {
-			emit(">[-]>[-]<<[>+>+<<-]>>[<<+>>-]<"), add(tok->value[i] - tok->value[i - 1]);
-		}
-		emit(">[-]"), add(tok->value[i]);
+/* an abstract interpretation of the code which keeps track of cells that
+ * hold known values. loops that can't run are removed, and clearing a cell
+ * with a known value is replaced by adding the difference. */
+int propagate_constants(Instruction* out_instr, int len)
+{
+	int* match = match_brackets(out_instr, len);
+	if (!match)
+		return len;
+
+	/* loops get scanned again once we reach their end, so the output
+	 * can't overwrite the input as we go */
+	Instruction* instr = bfm_malloc((len + 1) * sizeof(Instruction));
+	memcpy(instr, out_instr, len * sizeof(Instruction));
+
+	/* whether each loop returns the pointer to where it started */
+	char* balanced = bfm_malloc(len + 1);
+	int out = 0;
+
+	CellStates states = { NULL, 0, 0, 1, 0 }; /* every cell starts out as zero */
+
+	for (int i = 0; i < len; i++) {
+		Instruction in = instr[i];
+		CellState* cell = get_cell_state(&states, states.pos);
+
+		switch (in.op) {
+			case '>': case '<': case '+': case '-': case ',':
+				interpret_op(&states, in.op, in.count);
+				break;
+			case '[':
+				if (cell->known && !cell->value) {
+					for (int j = i; j <= match[i]; j++)
+						bytes_removed[RULE_ZERO_LOOP] += instr[j].count;
+					i = match[i];
+					continue;
+				}
+
+				if (match[i] == i + 2 && instr[i + 1].count == 1
+				    && (instr[i + 1].op == '-' || instr[i + 1].op == '+')) {
+					if (cell->known) {
+						long long amount = 0, j = i + 3;
+						for (; j < len && (instr[j].op == '+' || instr[j].op == '-'); j++)
+							amount += instr[j].op == '+' ? instr[j].count : -instr[j].count;
+
+						long long delta = (amount - cell->value) & cell_mask;
+						if (cheapest_add(delta) <= 3 + cheapest_add(amount) && cheapest_add(delta) <= INT_MAX) {
+							long removed = 3 + cheapest_add(amount) - cheapest_add(delta);
+							bytes_removed[RULE_REINIT] += removed;
+
+							cell->value = amount & cell_mask;
+							if (delta) {
+								out_instr[out] = instr[i];
+								out_instr[out].op = shortest_add(delta) < 0 ? '-' : '+';
+								out_instr[out++].count = cheapest_add(delta);
+							}
+
+							i = j - 1;
+							continue;
+						}
+					}
+
+					out_instr[out++] = instr[i], out_instr[out++] = instr[i + 1], out_instr[out++] = instr[i + 2];
+					cell->known = 1, cell->value = 0;
+					i += 2;
+					continue;
+				}
 
-		for (i = 0; i < tok->data - 1; i++) {
-			emit("<");
+				balanced[i] = forget_loop_cells(&states, instr, i, match[i]);
+				if (!balanced[i])
+					forget_cells(&states, 0);
+				break;
+			case ']':
+				leave_loop(&states, instr, match[i], i);
+				break;
 		}
-	}
-}
 
-#define SYNTAX_ASSERT(err_cond, err_str)                     \
-	do {                                                 \
-		if (err_cond) {                              \
-			push_error(tok->origin, 1, 1, err_str); \
-			*token = tok;                        \
-			return;                              \
-		}                                            \
-	} while(0);
+		out_instr[out++] = in;
+	}
 
-typedef struct {
-	char* name;
-	int data;
-} Definition;
-Definition definitions[4096];
-int num_definitions = 0;
+	free(states.cells);
+	free(instr);
+	free(match);
+	free(balanced);
 
-void add_definition(char* name, int data)
-{
-	definitions[num_definitions].name = name;
-	definitions[num_definitions++].data = data;
+	return out;
 }
 
-int get_definition_index(char* name)
+void print_optimizer_report()
 {
-	for (int i = 0; i < num_definitions; i++) {
-		if (!strcmp(definitions[i].name, name))
-			return i;
-	}
-	return -1;
+	for (int i = 0; i < NUM_RULES; i++)
+		printf("optimizer: %s removed %ld byte(s).\n", rule_names[i], bytes_removed[i]);
 }
 
+/* the code is lowered into these operations before it's run. pointer
+ * movement is folded into the offsets of the operations around it, and the
+ * common loop idioms become single operations. */
+enum {
+	OP_ADD, OP_MOVE,
+	OP_OUT, OP_IN,
+	OP_OPEN, OP_CLOSE,
+	OP_CLEAR, OP_MUL,
+	OP_SCAN
+};
+
 typedef struct {
-	char* name;
-	char** args;
-	int num_args, origin, *origins /* the locations of the arguments */;
-	Token* body;
-} Macro;
-Macro macros[4096];
-int num_macros = 0;
+	int op;
+	int arg;    /* the amount to add, the distance to move, or the factor */
+	int offset; /* the cell the operation works on, relative to the pointer */
+	int src;    /* the cell a multiplication reads from */
+	int jump;   /* the index of the matching loop operation */
 
-void add_macro(char* name, char** args, int num_args, Token* body, int origin, int* origins)
-{
-	macros[num_macros].name = name;
-	macros[num_macros].args = args;
-	macros[num_macros].num_args = num_args;
-	macros[num_macros].body = body;
-	macros[num_macros].origin = origin;
-	macros[num_macros].origins = origins;
-	num_macros++;
-}
+	/* how many brainfuck instructions running this operation stands for,
+	 * plus how many more for every iteration of a loop it replaced */
+	int steps, loop_steps;
+} Operation;
 
-int get_macro_index(char* name)
+Operation* ops = NULL;
+int ops_len = 0, ops_allocated = 0, pending_steps = 0;
+
+void push_operation(int op, int arg, int offset, int src)
 {
-	for (int i = 0; i < num_macros; i++) {
-		if (!strcmp(macros[i].name, name))
-			return i;
+	if (ops_len == ops_allocated) {
+		ops_allocated = ops_allocated ? 2 * ops_allocated : CODE_GROWTH_SPEED;
+		ops = bfm_realloc(ops, ops_allocated * sizeof(Operation));
 	}
-	return -1;
+
+	ops[ops_len].op = op;
+	ops[ops_len].arg = arg;
+	ops[ops_len].offset = offset;
+	ops[ops_len].src = src;
+	ops[ops_len].jump = -1;
+	ops[ops_len].steps = pending_steps;
+	ops[ops_len++].loop_steps = 0;
+
+	pending_steps = 0;
 }
 
-typedef struct {
-	char* name;
-	int location, scope, num_elements, ctx, used, origin;
-	enum {
-		VAR_CELL, VAR_ARRAY
-	} type;
-} Variable;
-Variable variables[4096];
-int num_variables = 0,
-	scope = 0, used_array_cells = 0,
-	used_variable_cells = 0,
-	context = 0;
+#define MAX_LOOP_CELLS 16
 
-int get_variable_index(char* varname)
+/* checks whether a loop only adds to cells, returns the pointer to where it
+ * started, and decrements its own cell once per iteration. if it does, the
+ * loop is just a series of multiplications followed by a clear. */
+int lower_multiply_loop(Instruction* instr, int start, int end, int pending)
 {
-	for (int i = 0; i < num_variables; i++) {
-		if (!strcmp(variables[i].name, varname) && (variables[i].ctx == context || variables[i].ctx == -1)) {
-			variables[i].used = 1;
-			return i;
+	int offsets[MAX_LOOP_CELLS], deltas[MAX_LOOP_CELLS], num_cells = 0, offset = 0, body_steps = 0;
+
+	for (int i = start + 1; i < end; i++) {
+		body_steps += instr[i].count;
+
+		switch (instr[i].op) {
+			case '>': offset += instr[i].count; break;
+			case '<': offset -= instr[i].count; break;
+			case '+': case '-': {
+				int j;
+				for (j = 0; j < num_cells; j++)
+					if (offsets[j] == offset) break;
+
+				if (j == num_cells) {
+					if (num_cells == MAX_LOOP_CELLS) return 0;
+					offsets[num_cells] = offset;
+					deltas[num_cells++] = 0;
+				}
+
+				deltas[j] += instr[i].op == '+' ? instr[i].count : -instr[i].count;
+			} break;
+			default: return 0;
 		}
 	}
-	return -1;
+
+	if (offset)
+		return 0;
+
+	int self = 0;
+	for (int j = 0; j < num_cells; j++)
+		if (!offsets[j]) self = deltas[j];
+
+	/* [+] clears a cell just as well as [-] does */
+	if (self != -1 && !(self == 1 && num_cells == 1))
+		return 0;
+
+	pending_steps++; /* the [ */
+
+	for (int j = 0; j < num_cells; j++)
+		if (offsets[j] && deltas[j])
+			push_operation(OP_MUL, deltas[j], pending + offsets[j], pending);
+
+	/* the direction tells the interpreter how many iterations were skipped */
+	push_operation(OP_CLEAR, self, pending, 0);
+	ops[ops_len - 1].loop_steps = body_steps + 1;
+
+	return 1;
 }
 
-void add_variable(char* varname, int num_elements, int type, int location, int ctx, int origin, int var_scope)
+void lower_code(Instruction* instr, int len)
 {
-	if (get_variable_index(varname) != -1 && context == ctx) {
-		push_error(origin, 0, 1, "variable already defined.");
-	}
+	int* match = match_brackets(instr, len);
+	if (!match)
+		fatal_error(-1, "the generated code has unbalanced brackets.");
 
-	if (get_definition_index(varname) != -1) {
-		push_error(origin, 0, 1, "variable name conflicts with a constant definition.");
+	int* stack = bfm_malloc((len + 1) * sizeof(int)), sp = 0;
+	int pending = 0; /* pointer movement that hasn't been emitted yet */
+
+	ops_len = 0, pending_steps = 0;
+
+#define FLUSH_MOVEMENT                                      \
+	if (pending) {                                      \
+		push_operation(OP_MOVE, pending, 0, 0);     \
+		pending = 0;                                \
 	}
 
-	if (type == VAR_CELL) {
-		variables[num_variables].location = location;
-	} else {
-		variables[num_variables].location = location;
-		used_array_cells += num_elements + 5;
+	for (int i = 0; i < len; i++) {
+		int count = instr[i].count;
+
+		if (instr[i].op != '[')
+			pending_steps += count;
+
+		switch (instr[i].op) {
+			case '>': pending += count; break;
+			case '<': pending -= count; break;
+			case '+': push_operation(OP_ADD, count, pending, 0); break;
+			case '-': push_operation(OP_ADD, -count, pending, 0); break;
+			case '.': push_operation(OP_OUT, count, pending, 0); break;
+			case ',': push_operation(OP_IN, count, pending, 0); break;
+			case '[':
+				if (lower_multiply_loop(instr, i, match[i], pending)) {
+					i = match[i];
+					break;
+				}
+
+				pending_steps++;
+				FLUSH_MOVEMENT
+
+				if (match[i] == i + 2 && (instr[i + 1].op == '>' || instr[i + 1].op == '<')) {
+					push_operation(OP_SCAN, instr[i + 1].op == '>' ? instr[i + 1].count : -instr[i + 1].count, 0, 0);
+					ops[ops_len - 1].loop_steps = instr[i + 1].count + 1;
+					i = match[i];
+					break;
+				}
+
+				stack[sp++] = ops_len;
+				push_operation(OP_OPEN, 0, 0, 0);
+				break;
+			case ']':
+				FLUSH_MOVEMENT
+
+				ops[stack[--sp]].jump = ops_len;
+				push_operation(OP_CLOSE, 0, 0, 0);
+				ops[ops_len - 1].jump = stack[sp];
+				break;
+		}
 	}
 
-	variables[num_variables].scope = scope;
-	variables[num_variables].type = type;
-	variables[num_variables].num_elements = num_elements;
-	variables[num_variables].ctx = ctx;
-	variables[num_variables].used = 0;
-	variables[num_variables].origin = origin;
-	variables[num_variables].scope = var_scope;
-	variables[num_variables++].name = varname;
+#undef FLUSH_MOVEMENT
+
+	free(stack);
+	free(match);
 }
 
-void kill_variables_of_context(int killcontext)
+#define TAPE_SIZE 65536
+
+long long steps_executed = 0, max_steps = -1;
+
+/* runs the lowered operations over the tape, keeping count of how many
+ * brainfuck instructions the unoptimized program would have executed.
+ * cells are kept within cell_mask. returns -1 if the pointer leaves the tape,
+ * including at the offset cells that stand for pointer movement. */
+int run_operations(Operation* op, int len, unsigned* tape, int tape_size, FILE* in, FILE* out)
 {
-	for (int i = 0; i < num_variables; i++) {
-		if (variables[i].used == 0 && variables[i].ctx == killcontext) {
-			push_error(variables[i].origin, 0, 0, "unused variable %s.", variables[i].name);
-		}
-	}
-	for (int i = num_variables - 1; i >= 0; i--) {
-		if (variables[i].ctx == killcontext) {
-			// printf("killing variable %s\n", variables[i].name);
-			num_variables--;
+	int p = 0;
+
+#define OFF_TAPE(offset) (p + (offset) < 0 || p + (offset) >= tape_size)
+
+	for (int i = 0; i < len; i++) {
+		steps_executed += op[i].steps;
+
+		/* a multiplication only visits its target if its loop runs */
+		if (op[i].op == OP_MUL) {
+			if (OFF_TAPE(op[i].src) || (tape[p + op[i].src] && OFF_TAPE(op[i].offset)))
+				return -1;
+		} else if (OFF_TAPE(op[i].offset))
+			return -1;
+
+		switch (op[i].op) {
+			case OP_ADD: tape[p + op[i].offset] = (tape[p + op[i].offset] + op[i].arg) & cell_mask; break;
+			case OP_MOVE:
+				p += op[i].arg;
+				if (p < 0 || p >= tape_size)
+					return -1;
+				break;
+			case OP_OUT:
+				for (int j = 0; j < op[i].arg; j++)
+					fputc(tape[p + op[i].offset] & 255, out);
+				break;
+			case OP_IN:
+				for (int j = 0; j < op[i].arg; j++) {
+					int c = fgetc(in);
+					if (c != EOF) tape[p + op[i].offset] = c;
+				}
+				break;
+			case OP_OPEN: if (!tape[p]) i = op[i].jump; break;
+			case OP_CLOSE:
+				if (max_steps >= 0 && steps_executed > max_steps)
+					i = len;
+				else if (tape[p])
+					i = op[i].jump;
+				break;
+			case OP_CLEAR: {
+				unsigned iterations = tape[p + op[i].offset];
+				if (op[i].arg == 1) iterations = -iterations & cell_mask;
+
+				steps_executed += (long long)iterations * op[i].loop_steps;
+				tape[p + op[i].offset] = 0;
+			} break;
+			case OP_MUL:
+				if (tape[p + op[i].src])
+					tape[p + op[i].offset] = (tape[p + op[i].offset] + tape[p + op[i].src] * op[i].arg) & cell_mask;
+				break;
+			case OP_SCAN:
+				while (tape[p]) {
+					p += op[i].arg;
+					steps_executed += op[i].loop_steps;
+					if (p < 0 || p >= tape_size)
+						return -1;
+				}
+				break;
 		}
 	}
+
+#undef OFF_TAPE
+
+	fflush(out);
+	return 0;
 }
 
-void kill_variables_of_scope(int killscope)
+void print_c_indent(FILE* file, int depth)
 {
-	for (int i = 0; i < num_variables; i++) {
-		if (variables[i].used == 0 && variables[i].scope == killscope) {
-			push_error(variables[i].origin, 0, 0, "unused variable %s.", variables[i].name);
-		}
-	}
-	for (int i = num_variables - 1; i >= 0; i--) {
-		if (variables[i].scope == killscope) {
-			// printf("killing variable %s\n", variables[i].name);
-			num_variables--;
-			if (variables[i].type == VAR_CELL) {
-				used_variable_cells--;
-			} else {
-				used_array_cells -= variables[i].num_elements + 5;
-			}
-		}
-	}
+	for (int i = 0; i < depth; i++)
+		fputc('\t', file);
 }
 
-/* TODO: clean up these macros */
-#define NEXT_TOKEN(t)                                                               \
-	do {                                                                        \
-		if (!(t->next)) {                                                   \
-			push_error(t->origin, 1, 1, "expected a valid token to follow."); \
-			return;                                                     \
-		} else t = t->next;                                                 \
-	} while (0);
+/* writes the lowered operations out as a C program, so hot programs can be
+ * built ahead of time by the system compiler. */
+void save_c_source(FILE* file, Operation* op, int len)
+{
+	if (!file) {
+		fatal_error(-1, "could not open output file.");
+		return;
+	}
 
-#define EXPECT_TOKEN(t, ttype, str)                                                                          \
-	do {                                                                                                 \
-		NEXT_TOKEN(t)                                                                                \
-		if (strcmp(t->value,str) || t->type != ttype) {                                              \
-			push_error(t->origin, 1, 1, "unexpected token \"%s\", expected \"%s\".\n", t->value, str); \
-		}                                                                                            \
-	} while (0);
+	int depth = 1, reads_input = 0;
 
-#define PARSE_EXPECT_TOKEN(t, ttype, str)                                                                          \
-	do {                                                                                                 \
-		PARSE_NEXT_TOKEN(t)                                                                                \
-		if (strcmp(t->value,str) || t->type != ttype) {                                              \
-			push_error(t->origin, 1, 1, "unexpected token \"%s\", expected \"%s\".\n", t->value, str); \
-		}                                                                                            \
-	} while (0);
+	for (int i = 0; i < len; i++)
+		if (op[i].op == OP_IN) reads_input = 1;
 
-#define PARSE_SYNTAX_ASSERT(err_cond, err_str)            \
-	do {                                              \
-		if (err_cond) {                           \
-			push_error(tok->origin, 1, 1, err_str); \
-			*token = tok;                     \
-			return - 1;                       \
-		}                                         \
-	} while(0);
+	fprintf(file, "#include <stdio.h>\n#include <stdint.h>\n#include <string.h>\n\n");
+	fprintf(file, "static uint%d_t tape[%d];\n\n", cell_bits, TAPE_SIZE);
+	fprintf(file, "int main(void)\n{\n\tuint%d_t* p = tape;\n", cell_bits);
+	fprintf(file, reads_input ? "\tint c;\n\n" : "\n");
 
-#define PARSE_NEXT_TOKEN(t)                                                         \
-	do {                                                                        \
-		if (!(t->next)) {                                                   \
-			push_error(t->origin, 1, 1, "expected a valid token to follow."); \
-			return -1;                                                  \
-		} else t = t->next;                                                 \
-	} while (0);
+	for (int i = 0; i < len; i++) {
+		int arg = op[i].arg, offset = op[i].offset;
 
-double term(Token** token);
-double expression(Token** token);
-double primary(Token** token)
-{
-	Token* tok = *token;
+		if (op[i].op == OP_CLOSE)
+			depth--;
 
-	int data = tok->data, type = tok->type;
+		print_c_indent(file, depth);
 
-	int def_idx = get_definition_index(tok->value);
-	if (type == TOK_IDENTIFIER && def_idx != -1) {
-		data = definitions[def_idx].data;
-		type = TOK_NUMBER;
+		switch (op[i].op) {
+			case OP_ADD:
+				fprintf(file, "p[%d] %s= %d;\n", offset, arg < 0 ? "-" : "+", abs(arg));
+				break;
+			case OP_MOVE:
+				fprintf(file, "p %s= %d;\n", arg < 0 ? "-" : "+", abs(arg));
+				break;
+			case OP_OUT:
+				for (int j = 0; j < arg; j++) {
+					if (j) print_c_indent(file, depth);
+					fprintf(file, "putchar(p[%d]);\n", offset);
+				}
+				break;
+			case OP_IN:
+				for (int j = 0; j < arg; j++) {
+					if (j) print_c_indent(file, depth);
+					fprintf(file, "if ((c = getchar()) != EOF) p[%d] = c;\n", offset);
+				}
+				break;
+			case OP_OPEN:
+				fprintf(file, "while (*p) {\n");
+				depth++;
+				break;
+			case OP_CLOSE:
+				fprintf(file, "}\n");
+				break;
+			case OP_CLEAR:
+				fprintf(file, "p[%d] = 0;\n", offset);
+				break;
+			case OP_MUL:
+				if (abs(arg) == 1)
+					fprintf(file, "p[%d] %s= p[%d];\n", offset, arg < 0 ? "-" : "+", op[i].src);
+				else
+					fprintf(file, "p[%d] += p[%d] * %d;\n", offset, op[i].src, arg);
+				break;
+			case OP_SCAN:
+				/* memchr gives NULL if there's no zero before the end of the tape */
+				if (arg == 1 && cell_bits == 8) {
+					fprintf(file, "if (!(p = memchr(p, 0, sizeof tape - (p - tape)))) {\n");
+					print_c_indent(file, depth + 1);
+					fprintf(file, "fputs(\"the program moved the pointer off of the tape.\\n\", stderr);\n");
+					print_c_indent(file, depth + 1);
+					fprintf(file, "return 1;\n");
+					print_c_indent(file, depth);
+					fprintf(file, "}\n");
+				} else
+					fprintf(file, "while (*p) p %s= %d;\n", arg < 0 ? "-" : "+", abs(arg));
+				break;
+		}
 	}
 
-	if (type == TOK_OPERATOR && data == MOP_LBRACE) {
-		PARSE_NEXT_TOKEN(tok)
-		double d = expression(&tok);
-		PARSE_NEXT_TOKEN(tok)
+	fprintf(file, "\n\treturn 0;\n}\n");
+}
 
-		/* TODO: replace this with EXPECT_TOKEN */
-		PARSE_SYNTAX_ASSERT(tok->type != TOK_OPERATOR, "unmatched lbrace.")
-		PARSE_SYNTAX_ASSERT(tok->data != MOP_RBRACE, "unmatched lbrace.")
+#ifdef HAVE_JIT
+/* a tiny x86-64 code generator for the lowered operations. the pointer to
+ * the current cell lives in rbx, putchar in r12 and getchar in r13. */
+unsigned char* jit_buf = NULL;
+int jit_len = 0, jit_allocated = 0;
 
-		*token = tok;
-		return d;
-	} else if (type == TOK_NUMBER) {
-		return (double)data;
+void jit_bytes(int num, ...)
+{
+	if (jit_len + num > jit_allocated) {
+		jit_allocated = 2 * jit_allocated + CODE_GROWTH_SPEED + num;
+		jit_buf = bfm_realloc(jit_buf, jit_allocated);
 	}
 
-	PARSE_SYNTAX_ASSERT(1, "unexpected token, expected a number or operator.");
+	va_list args;
+	va_start(args, num);
+	for (int i = 0; i < num; i++)
+		jit_buf[jit_len++] = (unsigned char)va_arg(args, int);
+	va_end(args);
 }
 
-double term(Token** token)
+void jit_int32(int value)
 {
-	Token* tok = *token;
-	double left = primary(&tok);
-	PARSE_NEXT_TOKEN(tok)
+	jit_bytes(4, value & 0xff, (value >> 8) & 0xff, (value >> 16) & 0xff, (value >> 24) & 0xff);
+}
 
-	while (1) {
-		if (tok->type == TOK_OPERATOR) {
-			switch (tok->data) {
-				case MOP_MUL:
-					PARSE_NEXT_TOKEN(tok)
-					left *= primary(&tok);
-					PARSE_NEXT_TOKEN(tok)
+void jit_patch_int32(int at, int value)
+{
+	for (int i = 0; i < 4; i++)
+		jit_buf[at + i] = (value >> (i * 8)) & 0xff;
+}
+
+void jit_compile(Operation* op, int len)
+{
+	int* targets = bfm_malloc((len + 1) * sizeof(int));
+	jit_len = 0;
+
+	jit_bytes(5, 0x53, 0x41, 0x54, 0x41, 0x55); /* push rbx; push r12; push r13 */
+	jit_bytes(3, 0x48, 0x89, 0xfb);             /* mov rbx, rdi */
+	jit_bytes(3, 0x49, 0x89, 0xf4);             /* mov r12, rsi */
+	jit_bytes(3, 0x49, 0x89, 0xd5);             /* mov r13, rdx */
+
+	for (int i = 0; i < len; i++) {
+		switch (op[i].op) {
+			case OP_ADD: /* add byte [rbx + offset], arg */
+				jit_bytes(2, 0x80, 0x83), jit_int32(op[i].offset), jit_bytes(1, op[i].arg & 0xff);
+				break;
+			case OP_MOVE: /* add rbx, arg */
+				jit_bytes(3, 0x48, 0x81, 0xc3), jit_int32(op[i].arg);
+				break;
+			case OP_CLEAR: /* mov byte [rbx + offset], 0 */
+				jit_bytes(2, 0xc6, 0x83), jit_int32(op[i].offset), jit_bytes(1, 0);
+				break;
+			case OP_MUL:
+				/* movzx eax, byte [rbx + src]; test eax, eax; je over the update,
+				 * since the loop doesn't visit its targets when it doesn't run */
+				jit_bytes(3, 0x0f, 0xb6, 0x83), jit_int32(op[i].src);
+				jit_bytes(4, 0x85, 0xc0, 0x74, op[i].arg == -1 || op[i].arg == 1 ? 6 : 12);
+
+				if (op[i].arg == -1) { /* sub byte [rbx + offset], al */
+					jit_bytes(2, 0x28, 0x83), jit_int32(op[i].offset);
 					break;
-				case MOP_DIV:
-					PARSE_NEXT_TOKEN(tok)
-					left /= primary(&tok);
-					PARSE_NEXT_TOKEN(tok)
-					break;
-				default:
-					*token = tok->prev;
-					return left;
-			}
-		} else {
-			*token = tok->prev;
-			return left;
+				}
+
+				if (op[i].arg != 1) /* imul eax, eax, arg */
+					jit_bytes(2, 0x69, 0xc0), jit_int32(op[i].arg);
+
+				/* add byte [rbx + offset], al */
+				jit_bytes(2, 0x00, 0x83), jit_int32(op[i].offset);
+				break;
+			case OP_OUT:
+				for (int j = 0; j < op[i].arg; j++) {
+					/* movzx edi, byte [rbx + offset]; call r12 */
+					jit_bytes(3, 0x0f, 0xb6, 0xbb), jit_int32(op[i].offset);
+					jit_bytes(3, 0x41, 0xff, 0xd4);
+				}
+				break;
+			case OP_IN:
+				for (int j = 0; j < op[i].arg; j++) {
+					/* call r13; cmp eax, -1; je over the store */
+					jit_bytes(8, 0x41, 0xff, 0xd5, 0x83, 0xf8, 0xff, 0x74, 0x06);
+					/* mov byte [rbx + offset], al */
+					jit_bytes(2, 0x88, 0x83), jit_int32(op[i].offset);
+				}
+				break;
+			case OP_OPEN: /* cmp byte [rbx], 0; je past the matching close */
+				jit_bytes(5, 0x80, 0x3b, 0x00, 0x0f, 0x84), jit_int32(0);
+				targets[i] = jit_len;
+				break;
+			case OP_CLOSE: /* cmp byte [rbx], 0; jne to the start of the body */
+				jit_bytes(5, 0x80, 0x3b, 0x00, 0x0f, 0x85), jit_int32(0);
+				targets[i] = jit_len;
+				jit_patch_int32(targets[i] - 4, targets[op[i].jump] - targets[i]);
+				jit_patch_int32(targets[op[i].jump] - 4, targets[i] - targets[op[i].jump]);
+				break;
+			case OP_SCAN:
+				/* cmp byte [rbx], 0; je over the loop; add rbx, arg; jmp back */
+				jit_bytes(5, 0x80, 0x3b, 0x00, 0x74, 0x09);
+				jit_bytes(3, 0x48, 0x81, 0xc3), jit_int32(op[i].arg);
+				jit_bytes(2, 0xeb, 0xf2);
+				break;
 		}
 	}
+
+	jit_bytes(6, 0x41, 0x5d, 0x41, 0x5c, 0x5b, 0xc3); /* pop r13; pop r12; pop rbx; ret */
+
+	free(targets);
 }
 
-double expression(Token** token)
+/* the tape sits between two inaccessible guards as large as itself. the
+ * pointer is checked against the current cell after every move, so as long
+ * as no operation reaches further than a guard, leaving the tape faults in
+ * one of them. */
+unsigned char* jit_tape = NULL;
+sigjmp_buf jit_off_tape;
+
+void jit_fault(int sig, siginfo_t* info, void* context)
 {
-	Token* tok = *token;
+	unsigned char* addr = info->si_addr;
+	(void)context;
 
-	double left = term(&tok);
-	PARSE_NEXT_TOKEN(tok)
+	if (addr >= jit_tape - TAPE_SIZE && addr < jit_tape + 2 * TAPE_SIZE)
+		siglongjmp(jit_off_tape, 1);
 
-	while (1) {
-		if (tok->type == TOK_OPERATOR) {
-			if (tok->data == MOP_ADD) {
-				PARSE_NEXT_TOKEN(tok)
-				left += term(&tok);
-				PARSE_NEXT_TOKEN(tok)
-			} else if (tok->data == MOP_SUB) {
-				PARSE_NEXT_TOKEN(tok)
-				left -= term(&tok);
-				PARSE_NEXT_TOKEN(tok)
-			} else {
-				*token = tok->prev;
-				return left;
-			}
+	/* not ours, fault again without the handler */
+	signal(sig, SIG_DFL);
+}
+
+int jit_run(Operation* op, int len)
+{
+	for (int i = 0; i < len; i++) {
+		int reach = op[i].op == OP_MOVE || op[i].op == OP_SCAN ? op[i].arg : op[i].offset;
+		if (abs(reach) >= TAPE_SIZE || abs(op[i].src) >= TAPE_SIZE)
+			return 0;
+	}
+
+	unsigned char* guarded = mmap(NULL, 3 * TAPE_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (guarded == MAP_FAILED)
+		return 0;
+
+	if (mprotect(guarded + TAPE_SIZE, TAPE_SIZE, PROT_READ | PROT_WRITE)) {
+		munmap(guarded, 3 * TAPE_SIZE);
+		return 0;
+	}
+
+	jit_compile(op, len);
+
+	void* mem = mmap(NULL, jit_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED) {
+		munmap(guarded, 3 * TAPE_SIZE);
+		return 0;
+	}
+
+	memcpy(mem, jit_buf, jit_len);
+	free(jit_buf);
+	jit_buf = NULL, jit_allocated = 0;
+
+	if (mprotect(mem, jit_len, PROT_READ | PROT_EXEC)) {
+		munmap(mem, jit_len);
+		munmap(guarded, 3 * TAPE_SIZE);
+		return 0;
+	}
+
+	/* ISO C doesn't allow casting object pointers to function pointers */
+	void (*program)(unsigned char*, int (*)(int), int (*)(void));
+	memcpy(&program, &mem, sizeof program);
+
+	struct sigaction action, previous;
+	memset(&action, 0, sizeof action);
+	action.sa_sigaction = jit_fault;
+	action.sa_flags = SA_SIGINFO;
+	sigemptyset(&action.sa_mask);
+
+	jit_tape = guarded + TAPE_SIZE;
+	sigaction(SIGSEGV, &action, &previous);
+
+	int off_tape = 0;
+	if (sigsetjmp(jit_off_tape, 1))
+		off_tape = 1;
+	else
+		program(jit_tape, putchar, getchar);
+
+	sigaction(SIGSEGV, &previous, NULL);
+	fflush(stdout);
+
+	munmap(guarded, 3 * TAPE_SIZE);
+	munmap(mem, jit_len);
+
+	if (off_tape)
+		fatal_error(-1, "the program moved the pointer off of the tape.");
+
+	return 1;
+}
+#endif
+
+/* the algorithms work in the first eight temp cells, printv runs a cell
+ * further for each digit as long as they are zero, and the last one holds
+ * null */
+int num_temp_cells = 11;
+int cell_pointer = 0, temp_cells = 0, temp_x = 0, temp_x_index = 0, temp_y = 0, temp_y_index = 0,
+	arrays = 0, if_cell;
+
+void move_pointer(int distance)
+{
+	cell_pointer += distance;
+	if (distance > 0)
+		emit_op('>', distance);
+	else
+		emit_op('<', -distance);
+}
+
+void move_pointer_to(int position)
+{
+	int cells_to_move = position - cell_pointer;
+	move_pointer(cells_to_move);
+}
+
+/* while code is being generated the same abstract interpretation keeps
+ * track of which cells hold known values, so that cheaper code can be picked
+ * for setting a cell. the body of a loop hasn't been generated yet when the
+ * loop starts, so nothing is known inside of it, and what was known before it
+ * is remembered for when it ends. inside a loop that doesn't return the
+ * pointer to where it started the tracker loses the pointer, and it only
+ * finds it again when the code generator tells it where the pointer is. */
+typedef struct {
+	int start; /* the index of the [ in the code */
+	int unbalanced;
+	CellStates snapshot; /* what was known before the loop */
+} TrackedLoop;
+
+CellStates tracker = { NULL, 0, 0, 1, 0 };
+TrackedLoop* tracked_loops = NULL;
+int tracked_loops_allocated = 0, tracked_depth = 0, tracker_lost = 0;
+
+void set_tracked_cell(int cell, unsigned value)
+{
+	if (tracker_lost || cell < 0)
+		return;
+
+	CellState* state = get_cell_state(&tracker, cell);
+	state->known = 1, state->value = value & cell_mask;
+}
+
+int get_known_value(int cell, unsigned* value)
+{
+	if (tracker_lost || cell < 0)
+		return 0;
+
+	CellState* state = get_cell_state(&tracker, cell);
+	*value = state->value;
+
+	return state->known;
+}
+
+int is_known_zero(int cell)
+{
+	unsigned value;
+	return get_known_value(cell, &value) && !value;
+}
+
+void track_loop_end()
+{
+	if (!tracked_depth) { /* the loop didn't start in generated code */
+		tracker_lost = 1;
+		return;
+	}
+
+	TrackedLoop* loop = &tracked_loops[--tracked_depth];
+
+	if (!loop->unbalanced && !tracker_lost) {
+		free(tracker.cells);
+		tracker = loop->snapshot;
+		loop->snapshot.cells = NULL;
+
+		if (leave_loop(&tracker, code, loop->start, code_len))
+			return;
+	}
+
+	free(loop->snapshot.cells);
+	tracker_lost = 1;
+	if (tracked_depth)
+		tracked_loops[tracked_depth - 1].unbalanced = 1;
+}
+
+void track_op(char op, int count)
+{
+	if (op == '[') {
+		if (tracked_depth == tracked_loops_allocated) {
+			tracked_loops_allocated += 64;
+			tracked_loops = bfm_realloc(tracked_loops, tracked_loops_allocated * sizeof(TrackedLoop));
+		}
+
+		TrackedLoop* loop = &tracked_loops[tracked_depth++];
+		loop->start = code_len;
+		loop->unbalanced = tracker_lost;
+		loop->snapshot.cells = NULL;
+
+		if (!tracker_lost) {
+			get_cell_state(&tracker, tracker.pos);
+			loop->snapshot = tracker;
+			loop->snapshot.cells = bfm_malloc(tracker.allocated * sizeof(CellState) + 1);
+			memcpy(loop->snapshot.cells, tracker.cells, tracker.allocated * sizeof(CellState));
+
+			/* nothing is known about the start of the next iteration */
+			forget_cells(&tracker, 0);
+		}
+
+		return;
+	}
+
+	if (op == ']') {
+		track_loop_end();
+		return;
+	}
+
+	if (!tracker_lost)
+		interpret_op(&tracker, op, count);
+}
+
+/* the code generator knows where the pointer is after code which moves it
+ * around unpredictably, such as the array algorithms. */
+void sync_tracker()
+{
+	if (tracker_lost) {
+		forget_cells(&tracker, 0);
+		tracker_lost = 0;
+	}
+
+	tracker.pos = cell_pointer;
+}
+
+enum {
+	ALGO_DIV, ALGO_MUL,
+	ALGO_ADD, ALGO_SUB,
+	ALGO_EQU, ALGO_MOD,
+	ALGO_GRT, ALGO_NOT,
+	ALGO_CEQU, ALGO_ARRAY_WRITE,
+	ALGO_ARRAY_READ, ALGO_PRINTV,
+	ALGO_OR, ALGO_DECIM,
+	ALGO_AND, ALGO_LESS
+};
+
+#define NUM_ALGORITHMS 16
+const char* const byte_algorithms[NUM_ALGORITHMS] = {
+	"0[-]1[-]2[-]3[-]x[0+x-]0[y[1+2+y-]2[y+2-]1[2+0-[2[-]3+0-]3[0+3-]2[1-[x-1[-]]+2-]1-]x+0]", /* x / y */
+	"0[-]1[-]x[1+x-]1[y[x+0+y-]0[y+0-]1-]", /* x * y */
+	"0[-]y[x+0+y-]0[y+0-]", /* x + y */
+	"0[-]y[x-0+y-]0[y+0-]", /* x - y */
+	"0[-]x[-]y[x+0+y-]0[y+0-]", /* x = y */
+	"0[-]1[-]2[-]3[-]4[-]5[-]6[-]x[1+x-]y[2+3+y-]3[y+3-]1[>->+<[>]>[<+>-]<<[<]>-]2[-]3[x+3-]x", /* x % y */
+	"0[-]1[-]2[-]3[-]4[-]5[-]x[3+x-]y[4+5+y-]5[y+5-]1+3[->[->]<<]<[-<+>>]>1[-]3[-]4[-]0[x+0-]", /* x > y */
+	"0[-]x[0+x[-]]+0[x-0-]", /* logical not */
+	"0[-]1[-]x[1+x-]+y[1-0+y-]0[y+0-]1[x-1[-]]", /* x == y */
+	"z[-x+x>>>+<<<z]x[-z+x]y[-x+x>+<y]x[-y+x]y[-x+x>>+<<y]x[-y+x]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<", /* x(y) = z (array write) */
+	"z[-y+y>+<z]y[-z+y]z[-y+y>>+<<z]y[-z+y]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<x[-]y>>>[-<<<x+y>>>]<<<", /* x = y(z) (array read) */
+	"0[-]1[-]2[-]3[-]4[-]5[-]6[-]7[-]x[0+1+x-]1[x+1-]0[>>+<<-]>+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<", /* printv */
+	"0[-]1[-]x[1+x-]1[x-1[-]]y[1+0+y-]0[y+0-]1[x[-]-1[-]]", /* logical or */
+	"0[-]>[-]+[[-]>[-],[+[-----------[>[-]++++++[<------>-]<--<<[->>++++++++++<<]>>[-<<+>>]<+>]]]<]<0[x+0-]", /* decimal input */
+	"0[-]1[-]x[1+x-]1[1[-]y[1+0+y-]0[y+0-]1[x+1[-]]]", /* logical and */
+	"0[-]1[-]2[-]3[-]4[-]5[-]y[3+5+y-]5[y+5-]x[4+x-]1+3[->[->]<<]<[-<+>>]>1[-]3[-]4[-]0[x+0-]", /* x < y */
+};
+
+/* the algorithms above that let a cell wrap around and then count it back
+ * down, which takes forever once cells are wider than eight bits. these
+ * never take a cell below zero. */
+const char* const wide_algorithms[NUM_ALGORITHMS] = {
+	[ALGO_DIV]  = "0[-]1[-]2[-]3[-]4[-]5[-]6[-]7[-]9[-]x[1+x-]y[2+3+y-]3[y+3-]1[>->+<[>]>[<+>-]>>>>+<<<<<<[<]>-]2[-]3[-]9[-]7[x+7-]", /* x / y */
+	[ALGO_CEQU] = "0[-]1[-]2[-]3[-]4[-]5[-]x[3+x-]y[4+5+y-]5[y+5-]0+1+3[->[->]<<]<[-<->>]>1[-]3[-]4[0[-]4[-]]0[x+0-]", /* x == y */
+	[ALGO_OR]   = "0[-]1[-]x[1+x-]1[x+1[-]]y[1+0+y-]0[y+0-]1[x[-]+1[-]]", /* logical or */
+};
+
+/* the algorithms for the cell width, from the tables above */
+const char* algorithms[NUM_ALGORITHMS];
+
+void set_cell_bits(int bits)
+{
+	cell_bits = bits;
+	cell_mask = bits == 32 ? 0xffffffffu : (1u << bits) - 1;
+
+	/* printv needs a cell for each digit of the biggest value */
+	num_temp_cells = 8;
+	for (unsigned biggest = cell_mask; biggest; biggest /= 10)
+		num_temp_cells++;
+
+	for (int i = 0; i < NUM_ALGORITHMS; i++)
+		algorithms[i] = bits != 8 && wide_algorithms[i] ? wide_algorithms[i] : byte_algorithms[i];
+}
+
+void emit_template(const char* algorithm, int x, int y, int z)
+{
+	int i = 0;
+	while (algorithm[i] != '\0') {
+		if (IS_BF_COMMAND(algorithm[i])) {
+			emit_char(algorithm[i]);
 		} else {
-			*token = tok->prev;
-			return left;
+			switch (algorithm[i]) {
+				case 'x': move_pointer_to(x); break;
+				case 'y': move_pointer_to(y); break;
+				case 'z': move_pointer_to(z); break;
+				default: move_pointer_to(temp_cells + (algorithm[i] - '0')); break;
+			}
 		}
+		i++;
 	}
+
+	sync_tracker();
+}
+
+void emit_algo(int algo, int x, int y, int z)
+{
+	emit_template(algorithms[algo], x, y, z);
+}
+
+void add(int amount)
+{
+	if (amount > 0)
+		emit_op('+', amount);
+	else
+		emit_op('-', -amount);
 }
 
+#define SYNTAX_ASSERT(err_cond, err_str)                     \
+	do {                                                 \
+		if (err_cond) {                              \
+			push_error(tok->origin, 1, 1, err_str); \
+			*token = tok;                        \
+			return;                              \
+		}                                            \
+	} while(0);
+
+/* the symbols of each kind are kept in an array, and a table chains the
+ * ones that hash to the same bucket through their indices, newest first.
+ * entries are only ever taken off the end of the array. */
 typedef struct {
-	char* code;
-	int cells_required;
-} BFConstant;
-BFConstant bf_constants[256] = {
-/* 0   */	{ "",                     1 },
-/* 1   */	{ "+",                    1 },
-/* 2   */	{ "++",                   1 },
-/* 3   */	{ "+++",                  1 },
-/* 4   */	{ "++++",                 1 },
-/* 5   */	{ "+++++",                1 },
-/* 6   */	{ "++++++",               1 },
-/* 7   */	{ "+++++++",              1 },
-/* 8   */	{ "++++++++",             1 },
-/* 9   */	{ "+++++++++",            1 },
-/* 10  */	{ "++++++++++",           1 },
-/* 11  */	{ "+++++++++++",          1 },
-/* 12  */	{ "++++++++++++",         1 },
-/* 13  */	{ "+++++++++++++",        1 },
-/* 14  */	{ "++++++++++++++",       1 },
-/* 15  */	{ "+++[>+++++<-]>",       2 },
-/* 16  */	{ "++++[>++++<-]>",       2 },
-/* 17  */	{ "++++[>++++<-]>+",      2 },
-/* 18  */	{ "+++[>++++++<-]>",      2 },
-/* 19  */	{ "+++[>++++++<-]>+",     2 },
-/* 20  */	{ "++++[>+++++<-]>",      2 },
-/* 21  */	{ "-[+[-<]>>++++]<",      6 },
-/* 22  */	{ ">++[++[<]>->+]<",      6 },
-/* 23  */	{ ">-[++++[<]>->+]<",     5 },
-/* 24  */	{ "++++[>++++++<-]>",     2 },
-/* 25  */	{ "+++++[>+++++<-]>",     2 },
-/* 26  */	{ ">++[[+<]>+>++]<-",     5 },
-/* 27  */	{ ">++[[+<]>+>++]<",      5 },
-/* 28  */	{ ">+[--[>+<<]>-]>",      4 },
-/* 29  */	{ ">+[--[<]>>+<-]>",      4 },
-/* 30  */	{ ">+[--[<]>>+<-]>+",     4 },
-/* 31  */	{ ">-[-[-<]>>+<]>--",     5 },
-/* 32  */	{ ">-[-[-<]>>+<]>-",      5 },
-/* 33  */	{ ">-[-[-<]>>+<]>",       5 },
-/* 34  */	{ ">-[-[-<]>>+<]>+",      5 },
-/* 35  */	{ ">+[++<[-<]>>+]<",      6 },
-/* 36  */	{ "+[->-[---<]>-]>",      6 },
-/* 37  */	{ "---[>+<+++++++]>",     2 },
-/* 38  */	{ ">--[>+<--[-<]>]>",     5 },
-/* 39  */	{ ">+[--[-<]>>+<]>",      5 },
-/* 40  */	{ ">+[--[-<]>>+<]>+",     5 },
-/* 41  */	{ "--[>+<++++++]>--",     2 },
-/* 42  */	{ "--[>+<++++++]>-",      2 },
-/* 43  */	{ "--[>+<++++++]>",       2 },
-/* 44  */	{ "--[>+<++++++]>+",      2 },
-/* 45  */	{ "-[+>+[+<]>+]>-",       5 },
-/* 46  */	{ "-[+>+[+<]>+]>",        5 },
-/* 47  */	{ "+[-[--<]>>--]<",       4 },
-/* 48  */	{ "-[>+<-----]>---",      2 },
-/* 49  */	{ "-[>+<-----]>--",       2 },
-/* 50  */	{ "-[>+<-----]>-",        2 },
-/* 51  */	{ "-[>+<-----]>",         2 },
-/* 52  */	{ "-[>+<-----]>+",        2 },
-/* 53  */	{ "-[>+<-----]>++",       2 },
-/* 54  */	{ "-[>+<-----]>+++",      2 },
-/* 55  */	{ ">-[++>+[+<]>]>-",      4 },
-/* 56  */	{ ">-[++>+[+<]>]>",       5 },
-/* 57  */	{ ">-[++>+[+<]>]>+",      4 },
-/* 58  */	{ ">-[++[+<]>>+<]>",      4 },
-/* 59  */	{ ">-[++[+<]>>+<]>+",     4 },
-/* 60  */	{ "-[+>+[+++<]>-]>",      4 },
-/* 61  */	{ "+[-[>+<<]>-]>--",      4 },
-/* 62  */	{ "+[-[>+<<]>-]>-",       4 },
-/* 63  */	{ "+[-[>+<<]>-]>",        4 },
-/* 64  */	{ "-[+[>+<<]>+]>",        4 },
-/* 65  */	{ ">+[+[<]>>+<+]>",       4 },
-/* 66  */	{ "--[++>+[<]>+]>",       5 },
-/* 67  */	{ "+[->-[--<]>-]>",       3 },
-/* 68  */	{ "+[->-[--<]>-]>+",      3 },
-/* 69  */	{ "+[->-[--<]>-]>++",     3 },
-/* 70  */	{ "-[+[>---<<]>+]>",      4 },
-/* 71  */	{ "-[>+<-------]>--",     2 },
-/* 72  */	{ "-[>+<-------]>-",      2 },
-/* 73  */	{ "-[>+<-------]>",       2 },
-/* 74  */	{ "-[>+<-------]>+",      2 },
-/* 75  */	{ "-[>+<-------]>++",     2 },
-/* 76  */	{ ">+++[[-<]>>--]<-",     4 },
-/* 77  */	{ ">+++[[-<]>>--]<",      4 },
-/* 78  */	{ "-[+>++[++<]>]>--",     3 },
-/* 79  */	{ "-[+>++[++<]>]>-",      3 },
-/* 80  */	{ "-[+>++[++<]>]>",       2 },
-/* 81  */	{ "-[>+<---]>----",       2 },
-/* 82  */	{ "-[>+<---]>---",        2 },
-/* 83  */	{ "-[>+<---]>--",         2 },
-/* 84  */	{ "-[>+<---]>-",          2 },
-/* 85  */	{ "-[>+<---]>",           2 },
-/* 86  */	{ "-[>+<---]>+",          2 },
-/* 87  */	{ "-[>+<---]>++",         2 },
-/* 88  */	{ "-[+[+<]>>+]<",         4 },
-/* 89  */	{ "-[+[+<]>>+]<+",        4 },
-/* 90  */	{ "-[+[+<]>>+]<++",       4 },
-/* 91  */	{ "-[+[+<]>>+]<+++",      4 },
-/* 92  */	{ "+[->---[-<]>-]>",      3 },
-/* 93  */	{ "-->+[[+++>]<+<]>",     3 },
-/* 94  */	{ "-->+[[+++>]<+<]>+",    3 },
-/* 95  */	{ "+[-[---<]>>-]<---",    3 },
-/* 96  */	{ ">-[-[--->]<<-]>--",    3 },
-/* 97  */	{ ">-[-[--->]<<-]>-",     3 },
-/* 98  */	{ "-[>++<-----]>----",    2 },
-/* 99  */	{ "-[>++<-----]>---",     2 },
-/* 100 */	{ "-[>++<-----]>--",      2 },
-/* 101 */	{ "-[>++<-----]>-",       2 },
-/* 102 */	{ "-[>++<-----]>",        2 },
-/* 103 */	{ "-[>++<-----]>+",       2 },
-/* 104 */	{ "-[>++<-----]>++",      2 },
-/* 105 */	{ "-[>++<-----]>+++",     2 },
-/* 106 */	{ "-[>++<-----]>++++",    2 },
-/* 107 */	{ "-[>++<-----]>+++++",   2 },
-/* 108 */	{ "-[>--<-------]>--",    2 },
-/* 109 */	{ "-[>--<-------]>-",     2 },
-/* 110 */	{ "-[>--<-------]>",      2 },
-/* 111 */	{ "-[>--<-------]>+",     2 },
-/* 112 */	{ "-[>--<-------]>++",    2 },
-/* 113 */	{ "-[>++<+++++++++]>-",   2 },
-/* 114 */	{ "-[>++<+++++++++]>",    2 },
-/* 115 */	{ "-[>++<+++++++++]>+",   2 },
-/* 116 */	{ "--------[>+++<--]>",   2 },
-/* 117 */	{ "----[>+++++<--]>-",    2 },
-/* 118 */	{ "----[>+++++<--]>",     2 },
-/* 119 */	{ "------[>+++<--]>",     2 },
-/* 120 */	{ "----[>+++<--]>--",     2 },
-/* 121 */	{ "----[>+++<--]>-",      2 },
-/* 122 */	{ "----[>+++<--]>",       2 },
-/* 123 */	{ "--[>+<--]>----",       2 },
-/* 124 */	{ "--[>+<--]>---",        2 },
-/* 125 */	{ "--[>+<--]>--",         2 },
-/* 126 */	{ "--[>+<--]>-",          2 },
-/* 127 */	{ "--[>+<--]>",           2 },
-/* 128 */	{ "--[>-<--]>-",          2 },
-/* 129 */	{ "--[>-<--]>",           2 },
-/* 130 */	{ "--[>-<--]>+",          2 },
-/* 131 */	{ "--[>-<--]>++",         2 },
-/* 132 */	{ "--[>-<--]>+++",        2 },
-/* 133 */	{ "--[>-<--]>++++",       2 },
-/* 134 */	{ "----[>---<--]>",       2 },
-/* 135 */	{ "----[>---<--]>+",      2 },
-/* 136 */	{ "----[>---<--]>++",     2 },
-/* 137 */	{ "------[>---<--]>",     2 },
-/* 138 */	{ "----[>-----<--]>",     2 },
-/* 139 */	{ "----[>-----<--]>+",    2 },
-/* 140 */	{ "--------[>---<--]>",   2 },
-/* 141 */	{ "-[>--<+++++++++]>-",   2 },
-/* 142 */	{ "-[>--<+++++++++]>",    2 },
-/* 143 */	{ "-[>--<+++++++++]>+",   2 },
-/* 144 */	{ "-[>++<-------]>--",    2 },
-/* 145 */	{ "-[>++<-------]>-",     2 },
-/* 146 */	{ "-[>++<-------]>",      2 },
-/* 147 */	{ "-[>++<-------]>+",     2 },
-/* 148 */	{ "-[>++<-------]>++",    2 },
-/* 149 */	{ "-[>--<-----]>-----",   2 },
-/* 150 */	{ "-[>--<-----]>----",    2 },
-/* 151 */	{ "-[>--<-----]>---",     2 },
-/* 152 */	{ "-[>--<-----]>--",      2 },
-/* 153 */	{ "-[>--<-----]>-",       2 },
-/* 154 */	{ "-[>--<-----]>",        2 },
-/* 155 */	{ "-[>--<-----]>+",       2 },
-/* 156 */	{ "-[>--<-----]>++",      2 },
-/* 157 */	{ "-[>--<-----]>+++",     2 },
-/* 158 */	{ "-[>--<-----]>++++",    2 },
-/* 159 */	{ "-[>--<-----]>+++++",   2 },
-/* 160 */	{ "-[>--<-----]>++++++",  2 },
-/* 161 */	{ "-[>--<-----]>+++++++", 2 },
-/* 162 */	{ "-[>-<---]>---------",  2 },
-/* 163 */	{ "-[>-<---]>--------",   2 },
-/* 164 */	{ "-[>-<---]>-------",    2 },
-/* 165 */	{ "-[>-<---]>------",     2 },
-/* 166 */	{ "-[>-<---]>-----",      2 },
-/* 167 */	{ "-[>-<---]>----",       2 },
-/* 168 */	{ "-[>-<---]>---",        2 },
-/* 169 */	{ "-[>-<---]>--",         2 },
-/* 170 */	{ "-[>-<---]>-",          2 },
-/* 171 */	{ "-[>-<---]>",           2 },
-/* 172 */	{ "-[>-<---]>+",          2 },
-/* 173 */	{ "-[>-<---]>++",         2 },
-/* 174 */	{ "-[>-<---]>+++",        2 },
-/* 175 */	{ "-[>-<---]>++++",       2 },
-/* 176 */	{ "-[>-<---]>+++++",      2 },
-/* 177 */	{ "-[>-<---]>++++++",     2 },
-/* 178 */	{ "-[>-<---]>+++++++",    2 },
-/* 179 */	{ "-[>-<---]>++++++++",   2 },
-/* 180 */	{ "-[>-<-------]>---",    2 },
-/* 181 */	{ "-[>-<-------]>--",     2 },
-/* 182 */	{ "-[>-<-------]>-",      2 },
-/* 183 */	{ "-[>-<-------]>",       2 },
-/* 184 */	{ "-[>-<-------]>+",      2 },
-/* 185 */	{ "-[>-<-------]>++",     2 },
-/* 186 */	{ "-[>-<-------]>+++",    2 },
-/* 187 */	{ "----[>+++<----]>--",   2 },
-/* 188 */	{ "----[>+++<----]>-",    2 },
-/* 189 */	{ "----[>+++<----]>",     2 },
-/* 190 */	{ "----[>-<----]>---",    2 },
-/* 191 */	{ "----[>-<----]>--",     2 },
-/* 192 */	{ "----[>-<----]>-",      2 },
-/* 193 */	{ "----[>-<----]>",       2 },
-/* 194 */	{ "----[>-<----]>+",      2 },
-/* 195 */	{ "----[>-<----]>++",     2 },
-/* 196 */	{ "----[>-<----]>+++",    2 },
-/* 197 */	{ "----[>-<----]>++++",   2 },
-/* 198 */	{ "-[>-<+++++++++]>-",    2 },
-/* 199 */	{ "-[>-<+++++++++]>",     2 },
-/* 200 */	{ "-[>-<-----]>-----",    2 },
-/* 201 */	{ "-[>-<-----]>----",     2 },
-/* 202 */	{ "-[>-<-----]>---",      2 },
-/* 203 */	{ "-[>-<-----]>--",       2 },
-/* 204 */	{ "-[>-<-----]>-",        2 },
-/* 205 */	{ "-[>-<-----]>",         2 },
-/* 206 */	{ "-[>-<-----]>+",        2 },
-/* 207 */	{ "-[>-<-----]>++",       2 },
-/* 208 */	{ "-[>-<-----]>+++",      2 },
-/* 209 */	{ "-[>-<-----]>++++",     2 },
-/* 210 */	{ "--[>-<++++++]>---",    2 },
-/* 211 */	{ "--[>-<++++++]>--",     2 },
-/* 212 */	{ "--[>-<++++++]>-",      2 },
-/* 213 */	{ "--[>-<++++++]>",       2 },
-/* 214 */	{ "--[>-<++++++]>+",      2 },
-/* 215 */	{ "--[>-<++++++]>++",     2 },
-/* 216 */	{ "--[>-<++++++]>+++",    2 },
-/* 217 */	{ "---[>-<+++++++]>--",   2 },
-/* 218 */	{ "---[>-<+++++++]>-",    2 },
-/* 219 */	{ "---[>-<+++++++]>",     2 },
-/* 220 */	{ "--[>++<+++++++]>",     2 },
-/* 221 */	{ "--[>++<+++++++]>+",    2 },
-/* 222 */	{ "--[>++<+++++++]>++",   2 },
-/* 223 */	{ "----[>--------<+]>-",  2 },
-/* 224 */	{ "----[>--------<+]>",   2 },
-/* 225 */	{ "-----[>------<+]>-",   2 },
-/* 226 */	{ "-----[>------<+]>",    2 },
-/* 227 */	{ "----[>-------<+]>-",   2 },
-/* 228 */	{ "----[>-------<+]>",    2 },
-/* 229 */	{ "---[>---------<+]>",   2 },
-/* 230 */	{ "-----[>-----<+]>-",    2 },
-/* 231 */	{ "-----[>-----<+]>",     2 },
-/* 232 */	{ "----[>------<+]>",     2 },
-/* 233 */	{ "----[>------<+]>+",    2 },
-/* 234 */	{ "---[>-------<+]>-",    2 },
-/* 235 */	{ "---[>-------<+]>",     2 },
-/* 236 */	{ "----[>-----<+]>",      2 },
-/* 237 */	{ "---[>------<+]>-",     2 },
-/* 238 */	{ "---[>------<+]>",      2 },
-/* 239 */	{ "----[>----<+]>-",      2 },
-/* 240 */	{ "----[>----<+]>",       2 },
-/* 241 */	{ "---[>-----<+]>",       2 },
-/* 242 */	{ "--------------",       1 },
-/* 243 */	{ "-------------",        1 },
-/* 244 */	{ "------------",         1 },
-/* 245 */	{ "-----------",          1 },
-/* 246 */	{ "----------",           1 },
-/* 247 */	{ "---------",            1 },
-/* 248 */	{ "--------",             1 },
-/* 249 */	{ "-------",              1 },
-/* 250 */	{ "------",               1 },
-/* 251 */	{ "-----",                1 },
-/* 252 */	{ "----",                 1 },
-/* 253 */	{ "---",                  1 },
-/* 254 */	{ "--",                   1 },
-/* 255 */	{ "-",                    1 }
+	int* heads; /* the newest entry in each bucket */
+	int* older; /* for each entry, the next older one in its bucket */
+	int num_buckets, allocated;
+	char* (*name_of)(int); /* the name of an entry, for rehashing */
+} SymbolTable;
+
+int symbol_bucket(SymbolTable* table, const char* name)
+{
+	return (int)((((uintptr_t)name >> 3) * 2654435761u) & (table->num_buckets - 1));
+}
+
+int first_symbol(SymbolTable* table, const char* name)
+{
+	return table->num_buckets ? table->heads[symbol_bucket(table, name)] : -1;
+}
+
+void clear_symbols(SymbolTable* table)
+{
+	for (int i = 0; i < table->num_buckets; i++)
+		table->heads[i] = -1;
+}
+
+void insert_symbol(SymbolTable* table, int index, const char* name)
+{
+	if (index >= table->allocated) {
+		table->allocated = 2 * (index + 1);
+		table->older = bfm_realloc(table->older, table->allocated * sizeof(int));
+	}
+
+	/* keep about one entry to a bucket */
+	if (index >= table->num_buckets) {
+		table->num_buckets = table->num_buckets ? 2 * table->num_buckets : 64;
+		table->heads = bfm_realloc(table->heads, table->num_buckets * sizeof(int));
+		clear_symbols(table);
+
+		for (int i = 0; i < index; i++) {
+			int bucket = symbol_bucket(table, table->name_of(i));
+			table->older[i] = table->heads[bucket];
+			table->heads[bucket] = i;
+		}
+	}
+
+	int bucket = symbol_bucket(table, name);
+	table->older[index] = table->heads[bucket];
+	table->heads[bucket] = index;
+}
+
+/* takes the newest entry off the table */
+void remove_symbol(SymbolTable* table, int index, const char* name)
+{
+	table->heads[symbol_bucket(table, name)] = table->older[index];
+}
+
+typedef struct {
+	char* name;
+	long long data;
+} Definition;
+Definition* definitions = NULL;
+int num_definitions = 0;
+
+char* definition_name(int i) { return definitions[i].name; }
+SymbolTable definition_table = { .name_of = definition_name };
+
+void add_definition(char* name, long long data)
+{
+	definitions = bfm_realloc(definitions, (num_definitions + 1) * sizeof(Definition));
+	definitions[num_definitions].name = name;
+	definitions[num_definitions].data = data;
+	insert_symbol(&definition_table, num_definitions++, name);
+}
+
+/* the first definition with the name wins */
+int get_definition_index(char* name)
+{
+	int found = -1;
+	for (int i = first_symbol(&definition_table, name); i != -1; i = definition_table.older[i])
+		if (definitions[i].name == name)
+			found = i;
+	return found;
+}
+
+typedef struct {
+	char* name;
+	char** args;
+	int num_args, origin, *origins /* the locations of the arguments */;
+	Token* body;
+} Macro;
+Macro* macros = NULL;
+int num_macros = 0;
+
+char* macro_name(int i) { return macros[i].name; }
+SymbolTable macro_table = { .name_of = macro_name };
+
+void add_macro(char* name, char** args, int num_args, Token* body, int origin, int* origins)
+{
+	macros = bfm_realloc(macros, (num_macros + 1) * sizeof(Macro));
+	insert_symbol(&macro_table, num_macros, name);
+	macros[num_macros].name = name;
+	macros[num_macros].args = args;
+	macros[num_macros].num_args = num_args;
+	macros[num_macros].body = body;
+	macros[num_macros].origin = origin;
+	macros[num_macros].origins = origins;
+	num_macros++;
+}
+
+/* every macro expansion that took place, for the size report */
+typedef struct {
+	int macro, parent;
+} Expansion;
+Expansion* expansions = NULL;
+int num_expansions = 0;
+
+void push_expansion(int macro_idx)
+{
+	expansions = bfm_realloc(expansions, (num_expansions + 1) * sizeof(Expansion));
+	expansions[num_expansions].macro = macro_idx;
+	expansions[num_expansions].parent = current_expansion;
+	current_expansion = num_expansions++;
+}
+
+int get_macro_index(char* name)
+{
+	int found = -1;
+	for (int i = first_symbol(&macro_table, name); i != -1; i = macro_table.older[i])
+		if (macros[i].name == name)
+			found = i;
+	return found;
+}
+
+/* how the elements of an array are laid out, and how an element at a
+ * variable index is found */
+enum {
+	ARRAY_WALK,    /* a marker walks to the element, carrying the index */
+	ARRAY_DIRECT,  /* one cell per element, picked by a chain of decisions */
+	ARRAY_BLOCKED  /* walking arrays of BLOCK_SIZE elements, picked by a chain of decisions */
+};
+
+#define NUM_ARRAY_LAYOUTS 3
+char array_layouts[NUM_ARRAY_LAYOUTS][8] = {
+	"walk", "direct", "blocked"
 };
 
-/* a cute little interpreter */
-int pointer_offset_interpreter(char* code)
+#define BLOCK_SIZE 16
+#define GROUP_SIZE 256 /* the most elements one index cell can reach */
+
+/* a cell variable's elements are its cells, more than one for var16 and
+ * var32 on narrow cells. they are little endian. a var16 on 32 bit cells
+ * keeps its width in bits, as it has to wrap before the cell does. */
+typedef struct {
+	char* name;
+	int location, scope, num_elements, ctx, used, origin, layout, bits;
+	enum {
+		VAR_CELL, VAR_ARRAY
+	} type;
+} Variable;
+Variable* variables = NULL;
+int num_variables = 0, variables_allocated = 0,
+	scope = 0, used_array_cells = 0,
+	context = 0,
+	widest_variable = 1;
+
+/* cells are handed to variables by how long they live rather than by scope.
+ * the walk below goes over the tokens the way the parser will, and notes for
+ * every declaration where it's last used and which cells the pointer travels
+ * between. variables that aren't live at the same time share a slot, and the
+ * slots are ordered so that the ones used together, and with the temp cells,
+ * are close.
+ *
+ * a macro's body is walked once, on its own, into a summary of the slots it
+ * needs and how it uses them and its arguments. every expansion declares the
+ * body's slots as variables that live for the expansion, so the walk doesn't
+ * grow with the expanded program. */
+typedef struct {
+	int cells, start, end, slot, reused; /* arguments take no cells */
+	int loop; /* the innermost loop of the walk it's declared in, or -1 */
+	int depth; /* how deep in blocks it's declared */
+	int first_read; /* whether it's read before it's set, -1 until it's used */
+	long weight; /* uses, each of which travels to the temp cells and back */
+} Declaration;
+
+typedef struct {
+	char* name;
+	int declaration, ctx, scope; /* the declaration is -1 for arrays */
+} Binding;
+
+typedef struct {
+	int a, b;
+	long weight;
+} Adjacency;
+
+/* a slot of the body, whether a variable had it before, and whether the loop
+ * it's declared in cleared it on the way in */
+typedef struct {
+	int slot, reused, cleared;
+} Site;
+
+/* a macro expanded in a loop has a summary of its own, walked as if the body
+ * were in a loop too, so that its variables keep their values between the
+ * iterations */
+typedef struct {
+	int walking, walked, looped;
+	int num_args, num_slots, num_sites, num_adjacencies;
+	int* widths; /* of each slot */
+	int* kept; /* whether a looped body reads the slot before it sets it */
+	Site* sites; /* for each declaration and each slot of each expansion, in the parser's order */
+	int num_loops;
+	int* loop_clears; /* where each loop's slots start in the clears, in the parser's order */
+	Site* clears; /* the slots cleared before entering a loop, always if reused or the loop's
+	               * inside another, else only if they aren't fresh */
+	long* weights; /* the uses of each argument, then of each slot */
+	Adjacency* adjacencies; /* between arguments and slots, numbered as the weights are */
+	int first_use, last_use; /* which of those the pointer travels from and to, or -1 */
+} Summary;
+
+Declaration* declarations = NULL;
+Binding* bindings = NULL;
+Adjacency* adjacencies = NULL;
+Summary* summaries = NULL, program_summary = { 0 };
+int* loops = NULL; /* the start and end of each while loop in the walk */
+int* program_locations = NULL; /* where the program's slots are */
+int num_declarations = 0, num_bindings = 0, num_adjacencies = 0, num_loops = 0,
+	first_use = -1, last_use = -1;
+
+Summary* summary_of(int macro_idx, int looped)
+{
+	return macro_idx < 0 ? &program_summary : &summaries[2 * macro_idx + looped];
+}
+
+/* the frames of the expansions being parsed, the program's at the bottom.
+ * each has the location of its body's slots, and whether they're still zero
+ * from the start of the program. */
+typedef struct {
+	Summary* summary;
+	int first_slot, next_site, next_loop, open_loops;
+} Frame;
+
+typedef struct {
+	int location, fresh;
+} FrameSlot;
+
+Frame* frames = NULL;
+FrameSlot* frame_slots = NULL;
+int num_frames = 0, frames_allocated = 0, num_frame_slots = 0, frame_slots_allocated = 0;
+
+Site next_site()
+{
+	Frame* frame = &frames[num_frames - 1];
+
+	/* only a syntax error leaves the parser off the walk's path */
+	if (frame->next_site == frame->summary->num_sites)
+		return (Site){ -1, 1, 0 };
+
+	return frame->summary->sites[frame->next_site++];
+}
+
+/* the location of the next declaration in the current frame, and whether its
+ * cells are still zero */
+int take_site(int* fresh)
+{
+	Site site = next_site();
+
+	if (site.slot < 0) {
+		*fresh = 0;
+		return 0;
+	}
+
+	FrameSlot* slot = &frame_slots[frames[num_frames - 1].first_slot + site.slot];
+	*fresh = !site.reused && (site.cleared || slot->fresh);
+	return slot->location;
+}
+
+/* the program's frame, or an expansion's frame made of the slots its sites
+ * in the current frame point at */
+void push_frame(Summary* summary)
+{
+	if (num_frames == frames_allocated) {
+		frames_allocated = frames_allocated ? 2 * frames_allocated : 64;
+		frames = bfm_realloc(frames, frames_allocated * sizeof(Frame));
+	}
+
+	if (num_frame_slots + summary->num_slots > frame_slots_allocated) {
+		frame_slots_allocated = 2 * (num_frame_slots + summary->num_slots) + 64;
+		frame_slots = bfm_realloc(frame_slots, frame_slots_allocated * sizeof(FrameSlot));
+	}
+
+	for (int i = 0; i < summary->num_slots; i++) {
+		FrameSlot* slot = &frame_slots[num_frame_slots + i];
+
+		if (!num_frames) {
+			*slot = (FrameSlot){ program_locations[i], 1 };
+		} else {
+			slot->location = take_site(&slot->fresh);
+		}
+	}
+
+	frames[num_frames++] = (Frame){ summary, num_frame_slots, 0, 0, 0 };
+	num_frame_slots += summary->num_slots;
+}
+
+void pop_frame()
+{
+	num_frame_slots = frames[--num_frames].first_slot;
+}
+
+/* how many cells a variable declared with the keyword takes */
+int variable_cells(int keyword)
+{
+	int bits = keyword == KYWRD_VAR16 ? 16 : keyword == KYWRD_VAR32 ? 32 : 0;
+	return bits > cell_bits ? bits / cell_bits : 1;
+}
+
+/* the width a variable declared with the keyword wraps at, if it's narrower
+ * than a cell, or zero */
+int variable_bits(int keyword)
+{
+	return keyword == KYWRD_VAR16 && cell_bits > 16 ? 16 : 0;
+}
+
+char* variable_name(int i) { return variables[i].name; }
+SymbolTable variable_table = { .name_of = variable_name };
+
+/* the oldest variable with the name that's visible in this context */
+int get_variable_index(char* varname)
+{
+	int found = -1;
+	for (int i = first_symbol(&variable_table, varname); i != -1; i = variable_table.older[i])
+		if (variables[i].name == varname && (variables[i].ctx == context || variables[i].ctx == -1))
+			found = i;
+
+	if (found != -1)
+		variables[found].used = 1;
+	return found;
+}
+
+void push_variable(Variable* var)
+{
+	if (num_variables == variables_allocated) {
+		variables_allocated = variables_allocated ? 2 * variables_allocated : 256;
+		variables = bfm_realloc(variables, variables_allocated * sizeof(Variable));
+	}
+
+	variables[num_variables] = *var;
+	insert_symbol(&variable_table, num_variables++, var->name);
+}
+
+void pop_variable()
+{
+	num_variables--;
+	remove_symbol(&variable_table, num_variables, variables[num_variables].name);
+}
+
+int array_cells(int num_elements, int layout)
+{
+	/* big arrays are split into groups, each laid out like a smaller array,
+	 * after two cells that hold the upper index byte of either operand */
+	if (num_elements > GROUP_SIZE) {
+		int cells = 2 + (num_elements / GROUP_SIZE) * array_cells(GROUP_SIZE, layout);
+		if (num_elements % GROUP_SIZE)
+			cells += array_cells(num_elements % GROUP_SIZE, layout);
+		return cells;
+	}
+
+	switch (layout) {
+		case ARRAY_DIRECT:  return num_elements;
+		case ARRAY_BLOCKED: return num_elements + 5 * ((num_elements + BLOCK_SIZE - 1) / BLOCK_SIZE);
+	}
+
+	return num_elements + 5;
+}
+
+void add_variable(char* varname, int num_elements, int type, int location, int ctx, int origin, int var_scope, int layout)
+{
+	if (get_variable_index(varname) != -1 && context == ctx) {
+		push_error(origin, 0, 1, "variable already defined.");
+	}
+
+	if (get_definition_index(varname) != -1) {
+		push_error(origin, 0, 1, "variable name conflicts with a constant definition.");
+	}
+
+	if (type == VAR_ARRAY)
+		used_array_cells += array_cells(num_elements, layout);
+
+	Variable var = { 0 };
+	var.location = location;
+	var.type = type;
+	var.num_elements = num_elements;
+	var.ctx = ctx;
+	var.used = 0;
+	var.origin = origin;
+	var.scope = var_scope;
+	var.layout = layout;
+	var.name = varname;
+	push_variable(&var);
+}
+
+/* a macro argument refers to the caller's variable and takes no cells of its own */
+void alias_variable(char* varname, int var_index, int ctx, int origin)
+{
+	if (get_variable_index(varname) != -1 && context == ctx) {
+		push_error(origin, 0, 1, "variable already defined.");
+	}
+
+	Variable var = variables[var_index];
+	var.ctx = ctx;
+	var.used = 0;
+	var.origin = origin;
+	var.scope = -1;
+	var.name = varname;
+	push_variable(&var);
+}
+
+/* where group g of an array starts, and how many elements it holds */
+int array_group(int var_index, int group)
+{
+	Variable* array = &variables[var_index];
+	if (array->num_elements <= GROUP_SIZE)
+		return array->location;
+
+	return array->location + 2 + group * array_cells(GROUP_SIZE, array->layout);
+}
+
+/* the cell holding the upper index byte for the left (0) or right (1) operand */
+int array_upper(int var_index, int side)
+{
+	return variables[var_index].location + side;
+}
+
+int group_elements(int var_index, int group)
+{
+	int rest = variables[var_index].num_elements - group * GROUP_SIZE;
+	return rest < GROUP_SIZE ? rest : GROUP_SIZE;
+}
+
+/* where block b of a blocked group starts */
+int array_block(int group, int block)
+{
+	return group + block * (BLOCK_SIZE + 5);
+}
+
+/* the cell an element rests in while the array isn't being walked */
+int array_element(int var_index, int index)
+{
+	int group = array_group(var_index, index / GROUP_SIZE);
+	index %= GROUP_SIZE;
+
+	switch (variables[var_index].layout) {
+		case ARRAY_DIRECT:  return group + index;
+		case ARRAY_BLOCKED: return array_block(group, index / BLOCK_SIZE) + 4 + index % BLOCK_SIZE;
+	}
+
+	return group + 4 + index;
+}
+
+/* the variables of the innermost context or scope are the newest ones */
+void kill_variables_of_context(int killcontext)
+{
+	int first = num_variables;
+	while (first > 0 && variables[first - 1].ctx == killcontext)
+		first--;
+
+	for (int i = first; i < num_variables; i++) {
+		if (variables[i].used == 0) {
+			push_error(variables[i].origin, 0, 0, "unused variable %s.", variables[i].name);
+		}
+	}
+	while (num_variables > first)
+		pop_variable();
+}
+
+void kill_variables_of_scope(int killscope)
+{
+	int first = num_variables;
+	while (first > 0 && variables[first - 1].scope == killscope)
+		first--;
+
+	for (int i = first; i < num_variables; i++) {
+		if (variables[i].used == 0) {
+			push_error(variables[i].origin, 0, 0, "unused variable %s.", variables[i].name);
+		}
+	}
+	while (num_variables > first) {
+		Variable* var = &variables[num_variables - 1];
+		if (var->type == VAR_ARRAY)
+			used_array_cells -= array_cells(var->num_elements, var->layout);
+		pop_variable();
+	}
+}
+
+/* TODO: clean up these macros */
+#define NEXT_TOKEN(t)                                                               \
+	do {                                                                        \
+		if (!(t->next)) {                                                   \
+			push_error(t->origin, 1, 1, "expected a valid token to follow."); \
+			return;                                                     \
+		} else t = t->next;                                                 \
+	} while (0);
+
+#define EXPECT_TOKEN(t, ttype, str)                                                                          \
+	do {                                                                                                 \
+		NEXT_TOKEN(t)                                                                                \
+		if (strcmp(t->value,str) || t->type != ttype) {                                              \
+			push_error(t->origin, 1, 1, "unexpected token \"%s\", expected \"%s\".\n", t->value, str); \
+		}                                                                                            \
+	} while (0);
+
+#define PARSE_EXPECT_TOKEN(t, ttype, str)                                                                          \
+	do {                                                                                                 \
+		PARSE_NEXT_TOKEN(t)                                                                                \
+		if (strcmp(t->value,str) || t->type != ttype) {                                              \
+			push_error(t->origin, 1, 1, "unexpected token \"%s\", expected \"%s\".\n", t->value, str); \
+		}                                                                                            \
+	} while (0);
+
+#define PARSE_SYNTAX_ASSERT(err_cond, err_str)            \
+	do {                                              \
+		if (err_cond) {                           \
+			push_error(tok->origin, 1, 1, err_str); \
+			*token = tok;                     \
+			return - 1;                       \
+		}                                         \
+	} while(0);
+
+#define PARSE_NEXT_TOKEN(t)                                                         \
+	do {                                                                        \
+		if (!(t->next)) {                                                   \
+			push_error(t->origin, 1, 1, "expected a valid token to follow."); \
+			return -1;                                                  \
+		} else t = t->next;                                                 \
+	} while (0);
+
+double term(Token** token);
+double expression(Token** token);
+double primary(Token** token)
+{
+	Token* tok = *token;
+
+	long long data = tok->data;
+	int type = tok->type;
+
+	int def_idx = get_definition_index(tok->value);
+	if (type == TOK_IDENTIFIER && def_idx != -1) {
+		data = definitions[def_idx].data;
+		type = TOK_NUMBER;
+	}
+
+	if (type == TOK_OPERATOR && data == MOP_LBRACE) {
+		PARSE_NEXT_TOKEN(tok)
+		double d = expression(&tok);
+		PARSE_NEXT_TOKEN(tok)
+
+		/* TODO: replace this with EXPECT_TOKEN */
+		PARSE_SYNTAX_ASSERT(tok->type != TOK_OPERATOR, "unmatched lbrace.")
+		PARSE_SYNTAX_ASSERT(tok->data != MOP_RBRACE, "unmatched lbrace.")
+
+		*token = tok;
+		return d;
+	} else if (type == TOK_NUMBER) {
+		return (double)data;
+	}
+
+	PARSE_SYNTAX_ASSERT(1, "unexpected token, expected a number or operator.");
+}
+
+double term(Token** token)
+{
+	Token* tok = *token;
+	double left = primary(&tok);
+	PARSE_NEXT_TOKEN(tok)
+
+	while (1) {
+		if (tok->type == TOK_OPERATOR) {
+			switch (tok->data) {
+				case MOP_MUL:
+					PARSE_NEXT_TOKEN(tok)
+					left *= primary(&tok);
+					PARSE_NEXT_TOKEN(tok)
+					break;
+				case MOP_DIV:
+					PARSE_NEXT_TOKEN(tok)
+					left /= primary(&tok);
+					PARSE_NEXT_TOKEN(tok)
+					break;
+				default:
+					*token = tok->prev;
+					return left;
+			}
+		} else {
+			*token = tok->prev;
+			return left;
+		}
+	}
+}
+
+double expression(Token** token)
+{
+	Token* tok = *token;
+
+	double left = term(&tok);
+	PARSE_NEXT_TOKEN(tok)
+
+	while (1) {
+		if (tok->type == TOK_OPERATOR) {
+			if (tok->data == MOP_ADD) {
+				PARSE_NEXT_TOKEN(tok)
+				left += term(&tok);
+				PARSE_NEXT_TOKEN(tok)
+			} else if (tok->data == MOP_SUB) {
+				PARSE_NEXT_TOKEN(tok)
+				left -= term(&tok);
+				PARSE_NEXT_TOKEN(tok)
+			} else {
+				*token = tok->prev;
+				return left;
+			}
+		} else {
+			*token = tok->prev;
+			return left;
+		}
+	}
+}
+
+typedef struct {
+	char* code;
+	int cells_required;
+} BFConstant;
+BFConstant bf_constants[256] = {
+/* 0   */	{ "",                     1 },
+/* 1   */	{ "+",                    1 },
+/* 2   */	{ "++",                   1 },
+/* 3   */	{ "+++",                  1 },
+/* 4   */	{ "++++",                 1 },
+/* 5   */	{ "+++++",                1 },
+/* 6   */	{ "++++++",               1 },
+/* 7   */	{ "+++++++",              1 },
+/* 8   */	{ "++++++++",             1 },
+/* 9   */	{ "+++++++++",            1 },
+/* 10  */	{ "++++++++++",           1 },
+/* 11  */	{ "+++++++++++",          1 },
+/* 12  */	{ "++++++++++++",         1 },
+/* 13  */	{ "+++++++++++++",        1 },
+/* 14  */	{ "++++++++++++++",       1 },
+/* 15  */	{ "+++[>+++++<-]>",       2 },
+/* 16  */	{ "++++[>++++<-]>",       2 },
+/* 17  */	{ "++++[>++++<-]>+",      2 },
+/* 18  */	{ "+++[>++++++<-]>",      2 },
+/* 19  */	{ "+++[>++++++<-]>+",     2 },
+/* 20  */	{ "++++[>+++++<-]>",      2 },
+/* 21  */	{ "-[+[-<]>>++++]<",      6 },
+/* 22  */	{ ">++[++[<]>->+]<",      6 },
+/* 23  */	{ ">-[++++[<]>->+]<",     5 },
+/* 24  */	{ "++++[>++++++<-]>",     2 },
+/* 25  */	{ "+++++[>+++++<-]>",     2 },
+/* 26  */	{ ">++[[+<]>+>++]<-",     5 },
+/* 27  */	{ ">++[[+<]>+>++]<",      5 },
+/* 28  */	{ ">+[--[>+<<]>-]>",      4 },
+/* 29  */	{ ">+[--[<]>>+<-]>",      4 },
+/* 30  */	{ ">+[--[<]>>+<-]>+",     4 },
+/* 31  */	{ ">-[-[-<]>>+<]>--",     5 },
+/* 32  */	{ ">-[-[-<]>>+<]>-",      5 },
+/* 33  */	{ ">-[-[-<]>>+<]>",       5 },
+/* 34  */	{ ">-[-[-<]>>+<]>+",      5 },
+/* 35  */	{ ">+[++<[-<]>>+]<",      6 },
+/* 36  */	{ "+[->-[---<]>-]>",      6 },
+/* 37  */	{ "---[>+<+++++++]>",     2 },
+/* 38  */	{ ">--[>+<--[-<]>]>",     5 },
+/* 39  */	{ ">+[--[-<]>>+<]>",      5 },
+/* 40  */	{ ">+[--[-<]>>+<]>+",     5 },
+/* 41  */	{ "--[>+<++++++]>--",     2 },
+/* 42  */	{ "--[>+<++++++]>-",      2 },
+/* 43  */	{ "--[>+<++++++]>",       2 },
+/* 44  */	{ "--[>+<++++++]>+",      2 },
+/* 45  */	{ "-[+>+[+<]>+]>-",       5 },
+/* 46  */	{ "-[+>+[+<]>+]>",        5 },
+/* 47  */	{ "+[-[--<]>>--]<",       4 },
+/* 48  */	{ "-[>+<-----]>---",      2 },
+/* 49  */	{ "-[>+<-----]>--",       2 },
+/* 50  */	{ "-[>+<-----]>-",        2 },
+/* 51  */	{ "-[>+<-----]>",         2 },
+/* 52  */	{ "-[>+<-----]>+",        2 },
+/* 53  */	{ "-[>+<-----]>++",       2 },
+/* 54  */	{ "-[>+<-----]>+++",      2 },
+/* 55  */	{ ">-[++>+[+<]>]>-",      4 },
+/* 56  */	{ ">-[++>+[+<]>]>",       4 },
+/* 57  */	{ ">-[++>+[+<]>]>+",      4 },
+/* 58  */	{ ">-[++[+<]>>+<]>",      4 },
+/* 59  */	{ ">-[++[+<]>>+<]>+",     4 },
+/* 60  */	{ "-[+>+[+++<]>-]>",      4 },
+/* 61  */	{ "+[-[>+<<]>-]>--",      4 },
+/* 62  */	{ "+[-[>+<<]>-]>-",       4 },
+/* 63  */	{ "+[-[>+<<]>-]>",        4 },
+/* 64  */	{ "-[+[>+<<]>+]>",        4 },
+/* 65  */	{ ">+[+[<]>>+<+]>",       4 },
+/* 66  */	{ "--[++>+[<]>+]>",       5 },
+/* 67  */	{ "+[->-[--<]>-]>",       3 },
+/* 68  */	{ "+[->-[--<]>-]>+",      3 },
+/* 69  */	{ "+[->-[--<]>-]>++",     3 },
+/* 70  */	{ "-[+[>---<<]>+]>",      4 },
+/* 71  */	{ "-[>+<-------]>--",     2 },
+/* 72  */	{ "-[>+<-------]>-",      2 },
+/* 73  */	{ "-[>+<-------]>",       2 },
+/* 74  */	{ "-[>+<-------]>+",      2 },
+/* 75  */	{ "-[>+<-------]>++",     2 },
+/* 76  */	{ ">+++[[-<]>>--]<-",     4 },
+/* 77  */	{ ">+++[[-<]>>--]<",      4 },
+/* 78  */	{ "-[+>++[++<]>]>--",     3 },
+/* 79  */	{ "-[+>++[++<]>]>-",      3 },
+/* 80  */	{ "-[+>++[++<]>]>",       3 },
+/* 81  */	{ "-[>+<---]>----",       2 },
+/* 82  */	{ "-[>+<---]>---",        2 },
+/* 83  */	{ "-[>+<---]>--",         2 },
+/* 84  */	{ "-[>+<---]>-",          2 },
+/* 85  */	{ "-[>+<---]>",           2 },
+/* 86  */	{ "-[>+<---]>+",          2 },
+/* 87  */	{ "-[>+<---]>++",         2 },
+/* 88  */	{ "-[+[+<]>>+]<",         4 },
+/* 89  */	{ "-[+[+<]>>+]<+",        4 },
+/* 90  */	{ "-[+[+<]>>+]<++",       4 },
+/* 91  */	{ "-[+[+<]>>+]<+++",      4 },
+/* 92  */	{ "+[->---[-<]>-]>",      3 },
+/* 93  */	{ "-->+[[+++>]<+<]>",     3 },
+/* 94  */	{ "-->+[[+++>]<+<]>+",    3 },
+/* 95  */	{ "+[-[---<]>>-]<---",    4 },
+/* 96  */	{ ">-[-[--->]<<-]>--",    3 },
+/* 97  */	{ ">-[-[--->]<<-]>-",     3 },
+/* 98  */	{ "-[>++<-----]>----",    2 },
+/* 99  */	{ "-[>++<-----]>---",     2 },
+/* 100 */	{ "-[>++<-----]>--",      2 },
+/* 101 */	{ "-[>++<-----]>-",       2 },
+/* 102 */	{ "-[>++<-----]>",        2 },
+/* 103 */	{ "-[>++<-----]>+",       2 },
+/* 104 */	{ "-[>++<-----]>++",      2 },
+/* 105 */	{ "-[>++<-----]>+++",     2 },
+/* 106 */	{ "-[>++<-----]>++++",    2 },
+/* 107 */	{ "-[>++<-----]>+++++",   2 },
+/* 108 */	{ "-[>--<-------]>--",    2 },
+/* 109 */	{ "-[>--<-------]>-",     2 },
+/* 110 */	{ "-[>--<-------]>",      2 },
+/* 111 */	{ "-[>--<-------]>+",     2 },
+/* 112 */	{ "-[>--<-------]>++",    2 },
+/* 113 */	{ "-[>++<+++++++++]>-",   2 },
+/* 114 */	{ "-[>++<+++++++++]>",    2 },
+/* 115 */	{ "-[>++<+++++++++]>+",   2 },
+/* 116 */	{ "--------[>+++<--]>",   2 },
+/* 117 */	{ "----[>+++++<--]>-",    2 },
+/* 118 */	{ "----[>+++++<--]>",     2 },
+/* 119 */	{ "------[>+++<--]>",     2 },
+/* 120 */	{ "----[>+++<--]>--",     2 },
+/* 121 */	{ "----[>+++<--]>-",      2 },
+/* 122 */	{ "----[>+++<--]>",       2 },
+/* 123 */	{ "--[>+<--]>----",       2 },
+/* 124 */	{ "--[>+<--]>---",        2 },
+/* 125 */	{ "--[>+<--]>--",         2 },
+/* 126 */	{ "--[>+<--]>-",          2 },
+/* 127 */	{ "--[>+<--]>",           2 },
+/* 128 */	{ "--[>-<--]>-",          2 },
+/* 129 */	{ "--[>-<--]>",           2 },
+/* 130 */	{ "--[>-<--]>+",          2 },
+/* 131 */	{ "--[>-<--]>++",         2 },
+/* 132 */	{ "--[>-<--]>+++",        2 },
+/* 133 */	{ "--[>-<--]>++++",       2 },
+/* 134 */	{ "----[>---<--]>",       2 },
+/* 135 */	{ "----[>---<--]>+",      2 },
+/* 136 */	{ "----[>---<--]>++",     2 },
+/* 137 */	{ "------[>---<--]>",     2 },
+/* 138 */	{ "----[>-----<--]>",     2 },
+/* 139 */	{ "----[>-----<--]>+",    2 },
+/* 140 */	{ "--------[>---<--]>",   2 },
+/* 141 */	{ "-[>--<+++++++++]>-",   2 },
+/* 142 */	{ "-[>--<+++++++++]>",    2 },
+/* 143 */	{ "-[>--<+++++++++]>+",   2 },
+/* 144 */	{ "-[>++<-------]>--",    2 },
+/* 145 */	{ "-[>++<-------]>-",     2 },
+/* 146 */	{ "-[>++<-------]>",      2 },
+/* 147 */	{ "-[>++<-------]>+",     2 },
+/* 148 */	{ "-[>++<-------]>++",    2 },
+/* 149 */	{ "-[>--<-----]>-----",   2 },
+/* 150 */	{ "-[>--<-----]>----",    2 },
+/* 151 */	{ "-[>--<-----]>---",     2 },
+/* 152 */	{ "-[>--<-----]>--",      2 },
+/* 153 */	{ "-[>--<-----]>-",       2 },
+/* 154 */	{ "-[>--<-----]>",        2 },
+/* 155 */	{ "-[>--<-----]>+",       2 },
+/* 156 */	{ "-[>--<-----]>++",      2 },
+/* 157 */	{ "-[>--<-----]>+++",     2 },
+/* 158 */	{ "-[>--<-----]>++++",    2 },
+/* 159 */	{ "-[>--<-----]>+++++",   2 },
+/* 160 */	{ "-[>--<-----]>++++++",  2 },
+/* 161 */	{ "-[>--<-----]>+++++++", 2 },
+/* 162 */	{ "-[>-<---]>---------",  2 },
+/* 163 */	{ "-[>-<---]>--------",   2 },
+/* 164 */	{ "-[>-<---]>-------",    2 },
+/* 165 */	{ "-[>-<---]>------",     2 },
+/* 166 */	{ "-[>-<---]>-----",      2 },
+/* 167 */	{ "-[>-<---]>----",       2 },
+/* 168 */	{ "-[>-<---]>---",        2 },
+/* 169 */	{ "-[>-<---]>--",         2 },
+/* 170 */	{ "-[>-<---]>-",          2 },
+/* 171 */	{ "-[>-<---]>",           2 },
+/* 172 */	{ "-[>-<---]>+",          2 },
+/* 173 */	{ "-[>-<---]>++",         2 },
+/* 174 */	{ "-[>-<---]>+++",        2 },
+/* 175 */	{ "-[>-<---]>++++",       2 },
+/* 176 */	{ "-[>-<---]>+++++",      2 },
+/* 177 */	{ "-[>-<---]>++++++",     2 },
+/* 178 */	{ "-[>-<---]>+++++++",    2 },
+/* 179 */	{ "-[>-<---]>++++++++",   2 },
+/* 180 */	{ "-[>-<-------]>---",    2 },
+/* 181 */	{ "-[>-<-------]>--",     2 },
+/* 182 */	{ "-[>-<-------]>-",      2 },
+/* 183 */	{ "-[>-<-------]>",       2 },
+/* 184 */	{ "-[>-<-------]>+",      2 },
+/* 185 */	{ "-[>-<-------]>++",     2 },
+/* 186 */	{ "-[>-<-------]>+++",    2 },
+/* 187 */	{ "----[>+++<----]>--",   2 },
+/* 188 */	{ "----[>+++<----]>-",    2 },
+/* 189 */	{ "----[>+++<----]>",     2 },
+/* 190 */	{ "----[>-<----]>---",    2 },
+/* 191 */	{ "----[>-<----]>--",     2 },
+/* 192 */	{ "----[>-<----]>-",      2 },
+/* 193 */	{ "----[>-<----]>",       2 },
+/* 194 */	{ "----[>-<----]>+",      2 },
+/* 195 */	{ "----[>-<----]>++",     2 },
+/* 196 */	{ "----[>-<----]>+++",    2 },
+/* 197 */	{ "----[>-<----]>++++",   2 },
+/* 198 */	{ "-[>-<+++++++++]>-",    2 },
+/* 199 */	{ "-[>-<+++++++++]>",     2 },
+/* 200 */	{ "-[>-<-----]>-----",    2 },
+/* 201 */	{ "-[>-<-----]>----",     2 },
+/* 202 */	{ "-[>-<-----]>---",      2 },
+/* 203 */	{ "-[>-<-----]>--",       2 },
+/* 204 */	{ "-[>-<-----]>-",        2 },
+/* 205 */	{ "-[>-<-----]>",         2 },
+/* 206 */	{ "-[>-<-----]>+",        2 },
+/* 207 */	{ "-[>-<-----]>++",       2 },
+/* 208 */	{ "-[>-<-----]>+++",      2 },
+/* 209 */	{ "-[>-<-----]>++++",     2 },
+/* 210 */	{ "--[>-<++++++]>---",    2 },
+/* 211 */	{ "--[>-<++++++]>--",     2 },
+/* 212 */	{ "--[>-<++++++]>-",      2 },
+/* 213 */	{ "--[>-<++++++]>",       2 },
+/* 214 */	{ "--[>-<++++++]>+",      2 },
+/* 215 */	{ "--[>-<++++++]>++",     2 },
+/* 216 */	{ "--[>-<++++++]>+++",    2 },
+/* 217 */	{ "---[>-<+++++++]>--",   2 },
+/* 218 */	{ "---[>-<+++++++]>-",    2 },
+/* 219 */	{ "---[>-<+++++++]>",     2 },
+/* 220 */	{ "--[>++<+++++++]>",     2 },
+/* 221 */	{ "--[>++<+++++++]>+",    2 },
+/* 222 */	{ "--[>++<+++++++]>++",   2 },
+/* 223 */	{ "----[>--------<+]>-",  2 },
+/* 224 */	{ "----[>--------<+]>",   2 },
+/* 225 */	{ "-----[>------<+]>-",   2 },
+/* 226 */	{ "-----[>------<+]>",    2 },
+/* 227 */	{ "----[>-------<+]>-",   2 },
+/* 228 */	{ "----[>-------<+]>",    2 },
+/* 229 */	{ "---[>---------<+]>",   2 },
+/* 230 */	{ "-----[>-----<+]>-",    2 },
+/* 231 */	{ "-----[>-----<+]>",     2 },
+/* 232 */	{ "----[>------<+]>",     2 },
+/* 233 */	{ "----[>------<+]>+",    2 },
+/* 234 */	{ "---[>-------<+]>-",    2 },
+/* 235 */	{ "---[>-------<+]>",     2 },
+/* 236 */	{ "----[>-----<+]>",      2 },
+/* 237 */	{ "---[>------<+]>-",     2 },
+/* 238 */	{ "---[>------<+]>",      2 },
+/* 239 */	{ "----[>----<+]>-",      2 },
+/* 240 */	{ "----[>----<+]>",       2 },
+/* 241 */	{ "---[>-----<+]>",       2 },
+/* 242 */	{ "--------------",       1 },
+/* 243 */	{ "-------------",        1 },
+/* 244 */	{ "------------",         1 },
+/* 245 */	{ "-----------",          1 },
+/* 246 */	{ "----------",           1 },
+/* 247 */	{ "---------",            1 },
+/* 248 */	{ "--------",             1 },
+/* 249 */	{ "-------",              1 },
+/* 250 */	{ "------",               1 },
+/* 251 */	{ "-----",                1 },
+/* 252 */	{ "----",                 1 },
+/* 253 */	{ "---",                  1 },
+/* 254 */	{ "--",                   1 },
+/* 255 */	{ "-",                    1 }
+};
+
+/* a cute little interpreter. it returns where the pointer ends up relative
+ * to where it started, and counts the instructions it executed. */
+int pointer_offset_interpreter(const char* code, long* steps)
+{
+	int len = strlen(code);
+	unsigned* mem = bfm_malloc((2 * len + 1) * sizeof(unsigned));
+	int* stack = bfm_malloc((len + 1) * sizeof(int));
+	int ip = 0, mp = len, sp = 0;
+	long executed = 0;
+
+	memset(mem, 0, (2 * len + 1) * sizeof(unsigned));
+
+	while (code[ip]) {
+		executed++;
+
+		switch (code[ip]) {
+			case '-': mem[mp] = (mem[mp] - 1) & cell_mask; break;
+			case '+': mem[mp] = (mem[mp] + 1) & cell_mask; break;
+			case '[': {
+				if (mem[mp]) {
+					stack[sp++] = ip;
+				} else {
+					int depth = 1;
+					do {
+						ip++;
+						if (code[ip] == '[') depth++;
+						else if (code[ip] == ']') depth--;
+					} while (depth);
+				}
+			} break;
+			case ']': ip = stack[--sp] - 1; break;
+			case '<': mp--; break;
+			case '>': mp++; break;
+		}
+
+		ip++;
+	}
+
+	free(mem);
+	free(stack);
+
+	if (steps)
+		*steps = executed;
+
+	return mp - len;
+}
+
+/* a sequence of code that sets a cell, built up before it's emitted so that
+ * different ways of setting a cell can be compared. the code is kept as run
+ * length records, so adding a large amount to a wide cell costs one record. */
+typedef struct {
+	Instruction* code;
+	int len, allocated;
+	int start, pos; /* where the pointer starts, and where it is now */
+	long cost; /* worked out once it's picked */
+} Candidate;
+
+void candidate_init(Candidate* c, int start)
+{
+	c->allocated = 16;
+	c->code = bfm_malloc(c->allocated * sizeof(Instruction));
+	c->len = 0;
+	c->start = c->pos = start;
+	c->cost = 0;
+}
+
+void candidate_append(Candidate* c, char op, long long count)
+{
+	if (op == '>') c->pos += count;
+	if (op == '<') c->pos -= count;
+
+	for (; count > 0; count -= INT_MAX) {
+		int n = count < INT_MAX ? count : INT_MAX;
+
+		Instruction* last = c->len ? &c->code[c->len - 1] : NULL;
+		if (last && last->op == op && op != '[' && op != ']' && last->count <= INT_MAX - n) {
+			last->count += n;
+			continue;
+		}
+
+		if (c->len == c->allocated) {
+			c->allocated *= 2;
+			c->code = bfm_realloc(c->code, c->allocated * sizeof(Instruction));
+		}
+		c->code[c->len++] = (Instruction){ op, n, 0, 0 };
+	}
+}
+
+void candidate_emit(Candidate* c, const char* str)
+{
+	for (; *str; str++)
+		if (IS_BF_COMMAND(*str))
+			candidate_append(c, *str, 1);
+}
+
+void candidate_move_to(Candidate* c, int cell)
+{
+	if (cell > c->pos) candidate_append(c, '>', cell - c->pos);
+	else candidate_append(c, '<', c->pos - cell);
+}
+
+void candidate_add(Candidate* c, long long amount)
+{
+	amount = shortest_add(amount);
+	if (amount < 0) candidate_append(c, '-', -amount);
+	else candidate_append(c, '+', amount);
+}
+
+enum {
+	OBJECTIVE_SIZE, OBJECTIVE_SPEED
+} objective = OBJECTIVE_SIZE;
+
+/* runs the code on cells that start out as zero, a run of adds taking as
+ * many steps as it's long, and gives up once it's taken more than limit */
+long candidate_steps(Candidate* c, long limit)
+{
+	int* match = bfm_malloc((c->len + 1) * sizeof(int));
+	int* stack = bfm_malloc((c->len + 1) * sizeof(int));
+	int moves = 0, sp = 0;
+	long steps = 0;
+
+	for (int i = 0; i < c->len; i++) {
+		if (c->code[i].op == '[') stack[sp++] = i;
+		if (c->code[i].op == ']') match[i] = stack[--sp], match[stack[sp]] = i;
+		if (c->code[i].op == '>' || c->code[i].op == '<') moves += c->code[i].count;
+	}
+
+	unsigned* mem = bfm_calloc(2 * moves + 1, sizeof(unsigned));
+	int mp = moves;
+
+	for (int ip = 0; ip < c->len && steps <= limit; ip++) {
+		Instruction in = c->code[ip];
+		steps += in.count;
+
+		switch (in.op) {
+			case '+': mem[mp] = (mem[mp] + in.count) & cell_mask; break;
+			case '-': mem[mp] = (mem[mp] - in.count) & cell_mask; break;
+			case '>': mp += in.count; break;
+			case '<': mp -= in.count; break;
+			case '[': if (!mem[mp]) ip = match[ip]; break;
+			case ']': ip = match[ip] - 1; break;
+		}
+	}
+
+	free(mem), free(match), free(stack);
+	return steps;
+}
+
+/* the cost of the candidate, or something more than limit once it's clear it
+ * costs more than that */
+long candidate_cost(Candidate* c, long limit)
+{
+	long cost = abs(c->start - cell_pointer);
+
+	if (objective == OBJECTIVE_SPEED)
+		return cost + candidate_steps(c, limit - cost);
+
+	for (int i = 0; i < c->len; i++)
+		cost += c->code[i].count;
+	return cost;
+}
+
+/* keeps whichever candidate is cheaper in best, and throws the other away.
+ * returns whether c was kept. */
+int pick_candidate(Candidate* best, Candidate* c)
+{
+	c->cost = candidate_cost(c, best->code ? best->cost : LONG_MAX);
+
+	if (!best->code || c->cost < best->cost) {
+		free(best->code);
+		*best = *c;
+		return 1;
+	}
+
+	free(c->code);
+	return 0;
+}
+
+void emit_candidate(Candidate* c)
+{
+	move_pointer_to(c->start);
+	for (int i = 0; i < c->len; i++)
+		emit_op(c->code[i].op, c->code[i].count);
+	cell_pointer = c->pos;
+	free(c->code);
+}
+
+/* clears a cell unless it's known to be zero, and tells the caller what the
+ * cell holds afterwards */
+unsigned candidate_prepare(Candidate* c, int cell)
+{
+	unsigned value;
+
+	if (get_known_value(cell, &value))
+		return value;
+
+	candidate_move_to(c, cell);
+	candidate_emit(c, "[-]");
+
+	return 0;
+}
+
+void candidate_clear(Candidate* c, int cell)
+{
+	unsigned value = candidate_prepare(c, cell);
+
+	if (value) {
+		candidate_move_to(c, cell);
+		candidate_add(c, -value);
+	}
+}
+
+#define NUM_SCRATCH_CELLS 6
+#define MAX_RADIX_DEPTH 4
+
+/* the searches for how to build a constant only depend on the difference
+ * being made and where the cells they use are, and every expansion of a
+ * macro asks for the same constants again, so the results are kept for
+ * the whole compile */
+enum {
+	SEARCH_MULTIPLY, SEARCH_RADIX
+};
+
+typedef struct {
+	int kind, used;
+	long long difference, where;
+	long long result[MAX_RADIX_DEPTH + 3];
+} ConstantSearch;
+
+ConstantSearch* constant_searches = NULL;
+int num_constant_searches = 0, constant_searches_allocated = 0;
+
+unsigned hash_constant_search(int kind, long long difference, long long where)
+{
+	unsigned long long hash = (unsigned long long)difference * 0x9e3779b97f4a7c15ull;
+	hash ^= ((unsigned long long)where + kind) * 0xc2b2ae3d27d4eb4full;
+	return hash ^ hash >> 29;
+}
+
+/* points entry at the result of a search, and returns zero if the search
+ * hasn't been done yet, in which case the caller fills it in */
+int find_constant_search(int kind, long long difference, long long where, ConstantSearch** entry)
+{
+	if (2 * (num_constant_searches + 1) > constant_searches_allocated) {
+		ConstantSearch* old = constant_searches;
+		int old_allocated = constant_searches_allocated;
+
+		constant_searches_allocated = old_allocated ? 2 * old_allocated : 256;
+		constant_searches = memset(arena_alloc(&compile_arena, constant_searches_allocated * sizeof(ConstantSearch)),
+		                           0, constant_searches_allocated * sizeof(ConstantSearch));
+
+		for (int i = 0; i < old_allocated; i++) {
+			if (!old[i].used)
+				continue;
+
+			unsigned slot = hash_constant_search(old[i].kind, old[i].difference, old[i].where) & (constant_searches_allocated - 1);
+			while (constant_searches[slot].used)
+				slot = (slot + 1) & (constant_searches_allocated - 1);
+			constant_searches[slot] = old[i];
+		}
+	}
+
+	unsigned slot = hash_constant_search(kind, difference, where) & (constant_searches_allocated - 1);
+	for (; constant_searches[slot].used; slot = (slot + 1) & (constant_searches_allocated - 1)) {
+		ConstantSearch* search = &constant_searches[slot];
+		if (search->kind == kind && search->difference == difference && search->where == where) {
+			*entry = search;
+			return 1;
+		}
+	}
+
+	*entry = &constant_searches[slot];
+	**entry = (ConstantSearch){ .kind = kind, .used = 1, .difference = difference, .where = where };
+	num_constant_searches++;
+
+	return 0;
+}
+
+/* cell = base + factor * amount + rest, looping on scratch */
+void multiply_candidate(Candidate* best, int cell, int scratch, unsigned value)
+{
+	unsigned base;
+	int known_base = get_known_value(cell, &base);
+	int d = abs(cell - scratch);
+	ConstantSearch* search;
+
+	if (!known_base)
+		base = 0;
+
+	if (!find_constant_search(SEARCH_MULTIPLY, shortest_add((long long)value - base), d, &search)) {
+		long best_cost = -1;
+
+		for (int factor = 2; factor <= 32; factor++) {
+			for (int amount = -64; amount <= 64; amount++) {
+				if (!amount)
+					continue;
+
+				int rest = cheapest_add((long long)value - base - factor * amount);
+
+				long cost;
+				if (objective == OBJECTIVE_SPEED)
+					cost = factor + factor * (2 * d + abs(amount) + 2) + rest;
+				else
+					cost = factor + 4 * d + abs(amount) + 3 + rest;
+
+				if (best_cost < 0 || cost < best_cost)
+					best_cost = cost, search->result[0] = factor, search->result[1] = amount;
+			}
+		}
+	}
+
+	int best_factor = search->result[0], best_amount = search->result[1];
+	long long rest = (long long)value - base - best_factor * best_amount;
+
+	/* adding what's left over costs at least as much as the best already */
+	if (best->code && cheapest_add(rest) >= best->cost)
+		return;
+
+	Candidate c;
+	candidate_init(&c, known_base ? scratch : cell);
+
+	candidate_prepare(&c, cell);
+	candidate_move_to(&c, scratch);
+	if (!is_known_zero(scratch))
+		candidate_emit(&c, "[-]");
+
+	candidate_append(&c, '+', best_factor);
+	candidate_emit(&c, "[");
+	candidate_move_to(&c, cell);
+	candidate_add(&c, best_amount);
+	candidate_move_to(&c, scratch);
+	candidate_emit(&c, "-]");
+	candidate_move_to(&c, cell);
+	candidate_add(&c, rest);
+
+	pick_candidate(best, &c);
+}
+
+/* cell = base + d0 + radix * (d1 + radix * (d2 + ...)), with one loop per
+ * digit after the first counting down on a scratch cell. it reaches the
+ * values of wide cells that one loop can't get near. */
+void radix_candidate(Candidate* best, int cell, unsigned value)
+{
+	int scratch[MAX_RADIX_DEPTH], num_scratch = 0;
+	for (int i = 0; i < NUM_SCRATCH_CELLS && num_scratch < MAX_RADIX_DEPTH; i++)
+		if (temp_cells + i != cell)
+			scratch[num_scratch++] = temp_cells + i;
+
+	unsigned base;
+	int known_base = get_known_value(cell, &base);
+	long long target = shortest_add((long long)value - (known_base ? base : 0));
+	ConstantSearch* search;
+
+	/* the scratch cells are fixed, so the cell being set stands for where they are */
+	if (!find_constant_search(SEARCH_RADIX, target, cell, &search)) {
+		long long digits[MAX_RADIX_DEPTH + 1];
+		long best_cost = -1;
+
+		for (int depth = 2; depth <= num_scratch; depth++) {
+			for (int radix = 2; radix <= 255; radix++) {
+				/* balanced digits, so each one is added or subtracted cheaply */
+				long long rest = target;
+				for (int k = 0; k < depth; k++) {
+					long long digit = ((rest % radix) + radix) % radix;
+					if (digit > radix / 2)
+						digit -= radix;
+					digits[k] = digit, rest = (rest - digit) / radix;
+				}
+				digits[depth] = rest;
+
+				if (!rest || llabs(rest) > 255)
+					continue;
+
+				/* estimated from the innermost loop outwards */
+				long cost = llabs(digits[depth]);
+				for (int k = depth - 1; k >= 0; k--) {
+					int d = abs(cell - scratch[k]);
+					if (objective == OBJECTIVE_SPEED)
+						cost = radix + 2 + radix * (cost + 2 * d + 2) + d + llabs(digits[k]);
+					else
+						cost += radix + 4 + 2 * d + llabs(digits[k]);
+				}
+
+				if (best_cost < 0 || cost < best_cost) {
+					best_cost = cost, search->result[0] = radix, search->result[1] = depth;
+					memcpy(&search->result[2], digits, sizeof(digits));
+				}
+			}
+		}
+	}
+
+	/* a depth of zero means no radix reaches the value */
+	int best_radix = search->result[0], best_depth = search->result[1];
+	long long* best_digits = &search->result[2];
+
+	if (!best_depth)
+		return;
+
+	Candidate c;
+	candidate_init(&c, known_base ? scratch[0] : cell);
+
+	candidate_prepare(&c, cell);
+	for (int k = 0; k < best_depth; k++) {
+		if (!is_known_zero(scratch[k])) {
+			candidate_move_to(&c, scratch[k]);
+			candidate_emit(&c, "[-]");
+		}
+	}
+
+	for (int k = 0; k < best_depth; k++) {
+		candidate_move_to(&c, scratch[k]);
+		candidate_append(&c, '+', best_radix);
+		candidate_emit(&c, "[");
+	}
+	candidate_move_to(&c, cell);
+	candidate_add(&c, best_digits[best_depth]);
+
+	for (int k = best_depth - 1; k >= 0; k--) {
+		candidate_move_to(&c, scratch[k]);
+		candidate_emit(&c, "-]");
+		candidate_move_to(&c, cell);
+		candidate_add(&c, best_digits[k]);
+	}
+
+	pick_candidate(best, &c);
+}
+
+void table_candidate(Candidate* best, int cell, unsigned value)
+{
+	/* the table's code can't set one of the cells it works in */
+	if (cell >= temp_cells && cell < temp_cells + bf_constants[value].cells_required)
+		return;
+
+	Candidate c;
+	candidate_init(&c, temp_cells);
+
+	for (int i = 0; i < bf_constants[value].cells_required; i++) {
+		if (!is_known_zero(temp_cells + i)) {
+			candidate_move_to(&c, temp_cells + i);
+			candidate_emit(&c, "[-]");
+		}
+	}
+	candidate_move_to(&c, temp_cells);
+
+	candidate_emit(&c, bf_constants[value].code);
+	int offset = pointer_offset_interpreter(bf_constants[value].code, NULL);
+	c.pos = temp_cells + offset;
+
+	if (!is_known_zero(cell)) {
+		candidate_move_to(&c, cell);
+		candidate_emit(&c, "[-]");
+	}
+
+	candidate_move_to(&c, temp_cells + offset);
+	candidate_emit(&c, "[");
+	candidate_move_to(&c, cell);
+	candidate_emit(&c, "+");
+	candidate_move_to(&c, temp_cells + offset);
+	candidate_emit(&c, "-]");
+
+	pick_candidate(best, &c);
+}
+
+/* picks the cheapest way to set a cell to a constant based on what the
+ * cell holds, which cells nearby are known to be zero, and where the
+ * pointer is. */
+void set_cell_to_constant(int cell, unsigned value)
+{
+	Candidate best = { 0 }, c;
+	value &= cell_mask;
+
+	/* add the difference, or clear the cell and add the value */
+	candidate_init(&c, cell);
+	candidate_add(&c, value - candidate_prepare(&c, cell));
+	pick_candidate(&best, &c);
+
+	/* multiply in place, using a cell that's zero or one we're allowed to clobber */
+	for (int scratch = cell - 3; scratch <= cell + 3; scratch++)
+		if (scratch != cell && is_known_zero(scratch))
+			multiply_candidate(&best, cell, scratch, value);
+
+	for (int i = 0; i < NUM_SCRATCH_CELLS; i++)
+		if (temp_cells + i != cell && abs(temp_cells + i - cell) > 3)
+			multiply_candidate(&best, cell, temp_cells + i, value);
+
+	/* the table relies on eight bit cells wrapping around, and wider cells
+	 * can hold values that one loop takes too long to reach */
+	if (cell_bits == 8)
+		table_candidate(&best, cell, value);
+	else
+		radix_candidate(&best, cell, value);
+
+	emit_candidate(&best);
+
+	sync_tracker();
+	set_tracked_cell(cell, value);
+}
+
+void clear_cell(int cell)
+{
+	if (!is_known_zero(cell)) {
+		move_pointer_to(cell);
+		emit("[-]");
+	}
+}
+
+/* moves x (or a copy of it) into temp_cells + 0 and divides it by k, which
+ * leaves the remainder in temp_cells + 2 and the quotient in temp_cells + 3 */
+void emit_divmod(int x, unsigned k, int keep)
+{
+	set_cell_to_constant(temp_cells + 1, k);
+	for (int i = 0; i < 6; i++)
+		if (i != 1)
+			clear_cell(temp_cells + i);
+
+	emit_template(keep ? "x[0+5+x-]5[x+5-]0" : "x[0+x-]0", x, -1, -1);
+	emit("[->-[>+>>]>[+[-<+>]>+>>]<<<<<]");
+	sync_tracker();
+	clear_cell(temp_cells + 1);
+}
+
+/* emits code for an operation with a constant right hand side which doesn't
+ * need the constant in a cell, and returns zero if there isn't any */
+int emit_constant_algo(int operation, int x, unsigned k)
+{
+	k &= cell_mask;
+
+	switch (operation) {
+		case MOP_MUL:
+			if (k == 1)
+				return 1;
+			/* a wide constant is cheaper to set up in a cell */
+			if (cheapest_add(k) > 128)
+				return 0;
+
+			clear_cell(temp_cells);
+			emit_template("x[0+x-]0[x", x, -1, -1);
+			add(shortest_add(k));
+			emit_template("0-]", x, -1, -1);
+			return 1;
+		case MOP_DIV:
+			if (!k)
+				return 0;
+			if (k == 1)
+				return 1;
+
+			emit_divmod(x, k, 0);
+			emit_template("2[-]3[x+3-]", x, -1, -1);
+			return 1;
+		case MOP_MOD:
+			if (!k)
+				return 0;
+			if (k == 1) {
+				move_pointer_to(x);
+				emit("[-]");
+				return 1;
+			}
+
+			emit_divmod(x, k, 0);
+			emit_template("3[-]2[x+2-]", x, -1, -1);
+			return 1;
+		case MOP_MORE: /* x > k when x / (k + 1) isn't zero */
+			if (k == cell_mask) {
+				move_pointer_to(x);
+				emit("[-]");
+				return 1;
+			}
+			if (!k) {
+				emit_template("0[-]x[0+x[-]]0[x+0-]", x, -1, -1);
+				return 1;
+			}
+
+			emit_divmod(x, k + 1, 0);
+			emit_template("2[-]3[x+3[-]]", x, -1, -1);
+			return 1;
+		case MOP_LESS: /* x < k when x / k is zero */
+			if (!k) {
+				move_pointer_to(x);
+				emit("[-]");
+				return 1;
+			}
+			if (k == 1) {
+				emit_algo(ALGO_NOT, x, -1, -1);
+				return 1;
+			}
+
+			emit_divmod(x, k, 0);
+			emit_template("2[-]x+3[x-3[-]]", x, -1, -1);
+			return 1;
+		case MOP_EQUEQU:
+			if (cheapest_add(k) > 128)
+				return 0;
+
+			move_pointer_to(x);
+			add(shortest_add(-(long long)k));
+			emit_algo(ALGO_NOT, x, -1, -1);
+			return 1;
+	}
+
+	return 0;
+}
+
+/* var16 and var32 on narrow cells work on one cell at a time, carrying
+ * between them in temp_cells + 4. past the algorithm temps they get two
+ * registers of widest_variable cells and then four flags, and printing
+ * keeps its digits from the second register on. */
+int wide_cell(int reg, int i)
+{
+	return temp_cells + 8 + reg * widest_variable + i;
+}
+
+int wide_digits(int cells)
+{
+	int digits = 0;
+	for (unsigned long long biggest = (1ull << (cells * cell_bits)) - 1; biggest; biggest /= 10)
+		digits++;
+
+	return digits;
+}
+
+void reserve_wide_cells()
+{
+	if (widest_variable < 2)
+		return;
+
+	int digits = wide_digits(widest_variable);
+	int cells = 8 + widest_variable + (digits > widest_variable + 4 ? digits : widest_variable + 4) + 1;
+	if (cells > num_temp_cells)
+		num_temp_cells = cells;
+}
+
+unsigned wide_byte(unsigned long long k, int i)
+{
+	return (unsigned)(k >> (i * cell_bits)) & cell_mask;
+}
+
+/* these count temp_cells + 0 down into the cell moved to temp_cells + 1 one
+ * at a time, and count the times it wraps in temp_cells + 4. they need
+ * temp_cells + 2 to be one and temp_cells + 3 to be zero. */
+#define CARRY_KERNEL  "0[->+[>-]>[->>+<]<+<<]"
+#define BORROW_KERNEL "0[->[>-]>[->>+<]<+<-<]"
+
+/* x += y (or x -= y) over n cells, or a constant k when y is negative. each
+ * cell of y is taken before the same cell of x is touched so that y can be
+ * x. the carry out of the top cell is kept in temp_cells + 4 if asked. */
+void emit_wide_add(int x, int n, int y, int y_cells, unsigned long long k, int subtract, int keep_carry)
+{
+	const char* kernel = subtract ? BORROW_KERNEL : CARRY_KERNEL;
+
+	for (int i = 0; i < 7; i++)
+		clear_cell(temp_cells + i);
+
+	for (int i = 0; i < n; i++) {
+		emit_template("4[6+4-]", -1, -1, -1);
+		if (y < 0)
+			set_cell_to_constant(temp_cells, wide_byte(k, i));
+		else if (i < y_cells)
+			emit_template("y[0+5+y-]5[y+5-]", -1, y + i, -1);
+
+		if (i == n - 1 && !keep_carry) {
+			emit_template(subtract ? "0[x-0-]6[x-6-]" : "0[x+0-]6[x+6-]", x + i, -1, -1);
+			break;
+		}
+
+		emit_template("x[1+x-]2+", x + i, -1, -1);
+		emit_template(kernel, -1, -1, -1);
+		emit_template("6[0+6-]", -1, -1, -1);
+		emit_template(kernel, -1, -1, -1);
+		emit_template("1[x+1-]2-", x + i, -1, -1);
+	}
+}
+
+/* x *= y by shifting y out of the second register top bit first, doubling
+ * the product in the first register and adding x for every bit that's set */
+void emit_wide_mul(int x, int n, int y, int y_cells, unsigned long long k)
+{
+	int product = wide_cell(0, 0), multiplier = wide_cell(1, 0), bits = wide_cell(2, 0), bit = wide_cell(2, 1);
+
+	for (int i = 0; i < n; i++) {
+		if (y < 0)
+			set_cell_to_constant(multiplier + i, wide_byte(k, i));
+		else if (i < y_cells)
+			emit_template("0[-]y[z+0+y-]0[y+0-]", -1, y + i, multiplier + i);
+	}
+
+	set_cell_to_constant(bits, n * cell_bits);
+	emit_template("z[", -1, -1, bits);
+	emit_wide_add(product, n, product, n, 0, 0, 0);
+	emit_wide_add(multiplier, n, multiplier, n, 0, 0, 1);
+	emit_template("4[z+4-]z[-", -1, -1, bit);
+	emit_wide_add(product, n, x, n, 0, 0, 0);
+	emit_template("z]", -1, -1, bit);
+	emit_template("z-]", -1, -1, bits);
+
+	for (int i = 0; i < n; i++)
+		emit_template("x[-]z[x+z-]", x + i, -1, product + i);
+}
+
+/* x = x == y, x < y or x > y over n cells, from the top cell down. the
+ * algorithms for wide cells never wrap, so they're linear on any cell. */
+void emit_wide_compare(int operation, int x, int n, int y, int y_cells)
+{
+	int less = wide_cell(2, 0), equal = wide_cell(2, 1), differ = wide_cell(2, 2), same = wide_cell(2, 3);
+	int null = temp_cells + num_temp_cells - 1;
+
+	clear_cell(less);
+	set_cell_to_constant(equal, 1);
+
+	for (int i = n - 1; i >= 0; i--) {
+		int a = x + i, b = i < y_cells ? y + i : null;
+
+		/* the first cells that differ decide, while the ones above are equal */
+		if (operation != MOP_EQUEQU) {
+			emit_algo(ALGO_EQU, differ, operation == MOP_LESS ? b : a, -1);
+			emit_template(algorithms[ALGO_GRT], differ, operation == MOP_LESS ? a : b, -1);
+			emit_algo(ALGO_AND, differ, equal, -1);
+			emit_algo(ALGO_ADD, less, differ, -1);
+			clear_cell(differ);
+		}
+
+		emit_algo(ALGO_EQU, same, a, -1);
+		emit_template(wide_algorithms[ALGO_CEQU], same, b, -1);
+		emit_algo(ALGO_AND, equal, same, -1);
+		clear_cell(same);
+	}
+
+	for (int i = 0; i < n; i++)
+		clear_cell(x + i);
+
+	emit_template("z[x+z-]", x, -1, operation == MOP_EQUEQU ? equal : less);
+	clear_cell(operation == MOP_EQUEQU ? less : equal);
+}
+
+/* prints x over n cells in decimal. the first register is divided by ten
+ * once for each digit, from the top cell down, where the remainder r carried
+ * into a cell is worth r * (cell_mask + 1) = r * (10 * k + m). */
+void emit_wide_print(int x, int n)
+{
+	int value = wide_cell(0, 0), digit = wide_cell(1, 0), digits = wide_digits(n);
+	unsigned long long base = (unsigned long long)cell_mask + 1;
+	int k = base / 10, m = base % 10;
+
+	for (int i = 0; i < n; i++)
+		emit_template("0[-]x[z+0+x-]0[x+0-]", x + i, -1, value + i);
+
+	set_cell_to_constant(temp_cells + 7, digits);
+	emit_template("7[", -1, -1, -1);
+	for (int d = digits - 1; d > 0; d--)
+		emit_template("y[x+y-]", digit + d, digit + d - 1, -1);
+
+	for (int i = n - 1; i >= 0; i--) {
+		/* the remainder waits in the first digit, which is empty until the
+		 * end, as setting up k can take any of the first six temps */
+		emit_divmod(value + i, 10, 0);
+		emit_template("3[x+3-]2[y+2-]6[-", value + i, digit, -1);
+		if (cheapest_add(k) <= 64) {
+			move_pointer_to(value + i);
+			add(k);
+		} else {
+			set_cell_to_constant(temp_cells, k);
+			emit_template("0[x+0-]", value + i, -1, -1);
+		}
+		move_pointer_to(digit);
+		add(m);
+		emit_template("6]y[6+y-]", -1, digit, -1);
+
+		emit_divmod(temp_cells + 6, 10, 0);
+		emit_template("3[x+3-]2[6+2-]", value + i, -1, -1);
+	}
+	emit_template("6[x+6-]7-]", digit, -1, -1);
+
+	/* the last digit worked out is the first one printed. leading zeros are
+	 * skipped while the sum of the digits so far is zero. */
+	for (int d = 0; d < digits - 1; d++) {
+		emit_template("0[-]x[6+0+x-]0[x+0-]6[7+0+6-]0[6+0-]7[x", digit + d, -1, -1);
+		add('0');
+		emit(".");
+		emit_template("7[-]]x[-]", digit + d, -1, -1);
+	}
+
+	move_pointer_to(digit + digits - 1);
+	add('0');
+	emit(".[-]");
+	clear_cell(temp_cells + 6);
+}
+
+/* reads a decimal number a character at a time, the same way the decimal
+ * input algorithm does, until a newline or the end of input. it's built up
+ * in the cells after the flags and then added to x over n cells. */
+void emit_wide_decimal(int x, int n)
+{
+	int more = wide_cell(2, 2), c = wide_cell(2, 3), number = wide_cell(2, 4);
+
+	set_cell_to_constant(more, 1);
+	emit_template("z[-y,[+[-----------[", -1, c, more);
+	move_pointer_to(c);
+	add(-38);
+	emit_wide_mul(number, n, -1, 0, 10);
+	emit_wide_add(number, n, c, 1, 0, 0, 0);
+	emit_template("y[-]z+y]]]z]", -1, c, more);
+
+	emit_wide_add(x, n, number, n, 0, 0, 0);
+	for (int i = 0; i < n; i++)
+		clear_cell(number + i);
+}
+
+/* one read (x = array(index)) or write (array(index) = x) of an element at a
+ * variable index. block holds which group of GROUP_SIZE elements the index
+ * is in, and is only looked at for arrays bigger than that. */
+typedef struct {
+	int var_index, write, x, index, block;
+	int group, num_elements; /* of the group being accessed */
+} ArrayAccess;
+
+void emit_group_access(ArrayAccess* access);
+
+/* emits case c of a chain of decisions, either picking a group or an element
+ * (or block) within a group */
+void emit_array_case(ArrayAccess* access, int picks_group, int c)
+{
+	if (picks_group) {
+		access->group = array_group(access->var_index, c);
+		access->num_elements = group_elements(access->var_index, c);
+		emit_group_access(access);
+		return;
+	}
+
+	int x = access->x;
+	if (variables[access->var_index].layout == ARRAY_DIRECT) {
+		if (access->write)
+			emit_algo(ALGO_EQU, access->group + c, x, -1);
+		else
+			emit_algo(ALGO_EQU, x, access->group + c, -1);
+	} else if (access->write) {
+		emit_algo(ALGO_ARRAY_WRITE, array_block(access->group, c), access->index, x); /* x(y) = z */
+	} else {
+		emit_algo(ALGO_ARRAY_READ, x, array_block(access->group, c), access->index); /* x = y(z) */
+	}
+}
+
+/* runs the case numbered by the value in sel, with the cell after sel as a
+ * flag that stops the shallower cases from running too. both end up zero,
+ * and nothing runs when sel is out of range. */
+void emit_array_switch(ArrayAccess* access, int picks_group, int sel, int c, int num_cases)
+{
+	move_pointer_to(sel);
+
+	if (c == num_cases) {
+		emit("[[-]"), move_pointer_to(sel + 1), emit("-"), move_pointer_to(sel), emit("]");
+		return;
+	}
+
+	emit("[-");
+	emit_array_switch(access, picks_group, sel, c + 1, num_cases);
+	move_pointer_to(sel + 1), emit("[");
+	emit_array_case(access, picks_group, c + 1);
+	move_pointer_to(sel + 1), emit("-]");
+	move_pointer_to(sel), emit("]");
+}
+
+void emit_switch(ArrayAccess* access, int picks_group, int sel, int num_cases)
+{
+	move_pointer_to(sel + 1), emit("+");
+	emit_array_switch(access, picks_group, sel, 0, num_cases - 1);
+	move_pointer_to(sel + 1), emit("[");
+	emit_array_case(access, picks_group, 0);
+	move_pointer_to(sel + 1), emit("-]");
+}
+
+/* accesses the element within access->group */
+void emit_group_access(ArrayAccess* access)
+{
+	int index = access->index;
+
+	switch (variables[access->var_index].layout) {
+		case ARRAY_WALK:
+			emit_array_case(access, 0, 0);
+			break;
+		case ARRAY_DIRECT:
+			emit_template("3[-]4[-]5[-]x[3+5+x-]5[x+5-]", index, -1, -1);
+			emit_switch(access, 0, temp_cells + 3, access->num_elements);
+			break;
+		default:
+			/* the block is picked by index / BLOCK_SIZE, and walked with index % BLOCK_SIZE */
+			emit_divmod(index, BLOCK_SIZE, 1);
+			access->index = temp_cells + 2;
+			emit_switch(access, 0, temp_cells + 3, (access->num_elements + BLOCK_SIZE - 1) / BLOCK_SIZE);
+			clear_cell(access->index);
+			access->index = index;
+			break;
+	}
+}
+
+void emit_array_access(int var_index, int write, int x, int index, int block)
+{
+	ArrayAccess access = { var_index, write, x, index, block, 0, 0 };
+	int num_elements = variables[var_index].num_elements;
+
+	if (num_elements > GROUP_SIZE) {
+		emit_template("6[-]7[-]0[-]x[6+0+x-]0[x+0-]", block, -1, -1);
+		emit_switch(&access, 1, temp_cells + 6, (num_elements + GROUP_SIZE - 1) / GROUP_SIZE);
+	} else {
+		access.group = array_group(var_index, 0);
+		access.num_elements = num_elements;
+		emit_group_access(&access);
+	}
+
+	sync_tracker();
+}
+
+/* x = array(block, index) */
+void emit_array_read(int var_index, int x, int index, int block)
+{
+	emit_array_access(var_index, 0, x, index, block);
+}
+
+/* array(block, index) = x */
+void emit_array_write(int var_index, int index, int block, int x)
+{
+	emit_array_access(var_index, 1, x, index, block);
+}
+
+/* parses the subscript after "[" up to and including "]", which is either
+ * one index or the upper and lower byte of an index into an array of more
+ * than GROUP_SIZE elements. constant subscripts give the cell of the element,
+ * everything else is copied into index and block to access the array with.
+ * returns 1 if the array needs to be accessed that way, -1 on errors. */
+int parse_subscript(Token** token, int var_index, int index, int block, int* element)
+{
+	Token* tok = *token;
+	int parts[2], constant[2], count = 0;
+
+	while (1) {
+		PARSE_SYNTAX_ASSERT(count == 2, "expected \"]\".")
+
+		int subscript_index = get_variable_index(tok->value);
+		if (tok->type == TOK_IDENTIFIER && subscript_index != -1) {
+			PARSE_SYNTAX_ASSERT(variables[subscript_index].type != VAR_CELL, "subscripts must not be arrays.")
+			parts[count] = variables[subscript_index].location;
+			constant[count++] = 0;
+		} else {
+			parts[count] = expression(&tok);
+			constant[count++] = 1;
+		}
+
+		PARSE_NEXT_TOKEN(tok)
+		if (tok->type == TOK_OPERATOR && tok->data == MOP_COMMA) {
+			PARSE_NEXT_TOKEN(tok)
+			continue;
+		}
+
+		PARSE_SYNTAX_ASSERT(tok->type != TOK_OPERATOR || tok->data != MOP_RBRACK, "expected \"]\".")
+		break;
+	}
+
+	*token = tok;
+
+	int num_elements = variables[var_index].num_elements;
+	PARSE_SYNTAX_ASSERT(count == 2 && num_elements <= GROUP_SIZE, "two part subscripts are for arrays of more than 256 elements.")
+
+	int lo = parts[count - 1], hi = count == 2 ? parts[0] : 0;
+	int lo_constant = constant[count - 1], hi_constant = count == 2 ? constant[0] : 1;
+
+	if (lo_constant && hi_constant) {
+		int i = hi * GROUP_SIZE + lo;
+		PARSE_SYNTAX_ASSERT(i < 0 || i >= num_elements || (count == 2 && (lo < 0 || lo >= GROUP_SIZE)), "array index out of bounds.")
+
+		*element = array_element(var_index, i);
+		return 0;
+	}
+
+	if (lo_constant)
+		set_cell_to_constant(index, lo);
+	else
+		emit_algo(ALGO_EQU, index, lo, -1);
+
+	if (num_elements > GROUP_SIZE) {
+		if (hi_constant)
+			set_cell_to_constant(block, hi);
+		else
+			emit_algo(ALGO_EQU, block, hi, -1);
+	}
+
+	return 1;
+}
+
+/* how often each name is subscripted with something other than a constant.
+ * passing an array to a macro counts too, since the macro might. the whole
+ * program is counted in one pass the first time an array's layout is
+ * estimated. */
+typedef struct {
+	char* name;
+	int variable_subscripts, defined;
+} NameUse;
+NameUse* name_uses = NULL;
+int num_name_uses = 0, name_uses_counted = 0;
+
+char* name_use_name(int i) { return name_uses[i].name; }
+SymbolTable name_use_table = { .name_of = name_use_name };
+
+NameUse* get_name_use(char* name)
+{
+	for (int i = first_symbol(&name_use_table, name); i != -1; i = name_use_table.older[i])
+		if (name_uses[i].name == name)
+			return &name_uses[i];
+
+	name_uses = bfm_realloc(name_uses, (num_name_uses + 1) * sizeof(NameUse));
+	name_uses[num_name_uses] = (NameUse){ name, 0, 0 };
+	insert_symbol(&name_use_table, num_name_uses, name);
+	return &name_uses[num_name_uses++];
+}
+
+void count_name_uses(Token* tok)
+{
+	while (tok->prev)
+		tok = tok->prev;
+
+	/* names given to define are constants wherever they're used */
+	for (Token* t = tok; t; t = t->next)
+		if (t->type == TOK_KYWRD && t->data == KYWRD_DEFINE && t->next && t->next->type == TOK_IDENTIFIER)
+			get_name_use(t->next->value)->defined = 1;
+
+	for (; tok; tok = tok->next) {
+		if (tok->type != TOK_IDENTIFIER)
+			continue;
+		if (tok->prev && tok->prev->type == TOK_KYWRD && tok->prev->data == KYWRD_ARRAY)
+			continue;
+
+		Token* next = tok->next;
+		if (!next || next->type != TOK_OPERATOR || next->data != MOP_LBRACK) {
+			get_name_use(tok->value)->variable_subscripts++;
+		} else if (next->next && next->next->type == TOK_IDENTIFIER
+		           && !get_name_use(next->next->value)->defined) {
+			get_name_use(tok->value)->variable_subscripts++;
+		}
+	}
+
+	name_uses_counted = 1;
+}
+
+int count_variable_subscripts(Token* tok, char* name)
+{
+	if (!name_uses_counted)
+		count_name_uses(tok);
+
+	return get_name_use(name)->variable_subscripts;
+}
+
+/* what a read at a variable index costs with each layout: the size of its
+ * code, and the steps it takes on average over every index. these are fits
+ * of what make array-costs measures on arrays of 4 to 255 elements. walking
+ * takes a number of steps quadratic in the distance, direct arrays have code
+ * quadratic in the number of elements, and blocked arrays in the number of
+ * blocks. the fastest layout is only picked for speed while its code stays
+ * within MAX_ACCESS_SIZE per access. arrays which are only ever used at
+ * constant indices are never walked. */
+#define MAX_ACCESS_SIZE 16384
+
+int choose_array_layout(int num_elements, int num_variable_subscripts)
+{
+	if (!num_variable_subscripts)
+		return ARRAY_DIRECT;
+
+	long n = num_elements, num_blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	long size[NUM_ARRAY_LAYOUTS], steps[NUM_ARRAY_LAYOUTS];
+
+	size[ARRAY_WALK] = 436;
+	steps[ARRAY_WALK] = 10 * n * n / 3 + 82 * n + 51;
+
+	size[ARRAY_DIRECT] = 3 * n * n + 102 * n + 168;
+	steps[ARRAY_DIRECT] = 34 * n + 74;
+
+	size[ARRAY_BLOCKED] = 168 * num_blocks * num_blocks + 142 * num_blocks + 233;
+	steps[ARRAY_BLOCKED] = 169 * n / 2 + 1150;
+
+	int best = ARRAY_WALK;
+	for (int layout = 0; layout < NUM_ARRAY_LAYOUTS; layout++) {
+		if (objective == OBJECTIVE_SPEED) {
+			if (size[layout] <= MAX_ACCESS_SIZE && steps[layout] < steps[best])
+				best = layout;
+		} else if (size[layout] < size[best]) {
+			best = layout;
+		}
+	}
+
+	return best;
+}
+
+/* nudges cells towards the targets with one loop on counter, which must be
+ * zero and must not be one of the cells. a factor of zero just adds the
+ * targets directly. */
+void seed_cells(Candidate* c, int counter, const int* cells, unsigned* values, const unsigned* targets, int n, int factor)
+{
+	if (!factor) {
+		for (int i = 0; i < n; i++) {
+			candidate_move_to(c, cells[i]);
+			candidate_add(c, targets[i] - values[i]);
+			values[i] = targets[i];
+		}
+		return;
+	}
+
+	candidate_move_to(c, counter);
+	candidate_add(c, factor);
+	candidate_emit(c, "[");
+
+	for (int i = 0; i < n; i++) {
+		long long delta = shortest_add(targets[i] - values[i]);
+		long long amount = (delta + (delta < 0 ? -factor : factor) / 2) / factor;
+		if (!amount)
+			continue;
+
+		candidate_move_to(c, cells[i]);
+		candidate_add(c, amount);
+		values[i] = (values[i] + amount * factor) & cell_mask;
+	}
+
+	candidate_move_to(c, counter);
+	candidate_emit(c, "-]");
+}
+
+/* splits the sorted characters into groups and returns the median of each
+ * group, chosen so that the distance of every character to the median of
+ * its group is as small as possible. */
+void cluster_characters(const int* counts, int num_groups, unsigned* centers)
+{
+	int chars[256], num_chars = 0;
+	for (int i = 0; i < 256; i++)
+		if (counts[i])
+			chars[num_chars++] = i;
+
+	long cost[NUM_SCRATCH_CELLS + 1][257];
+	static int split[NUM_SCRATCH_CELLS + 1][257], median[257][257];
+	static long group_cost[257][257];
+
+	for (int i = 0; i < num_chars; i++) {
+		for (int j = i + 1; j <= num_chars; j++) {
+			int total = 0, seen = 0, m = i;
+			for (int k = i; k < j; k++)
+				total += counts[chars[k]];
+			for (m = i; m < j; m++) {
+				seen += counts[chars[m]];
+				if (2 * seen >= total)
+					break;
+			}
+
+			median[i][j] = chars[m];
+			group_cost[i][j] = 0;
+			for (int k = i; k < j; k++)
+				group_cost[i][j] += (long)counts[chars[k]] * abs(chars[k] - chars[m]);
+		}
+	}
+
+	for (int j = 0; j <= num_chars; j++)
+		cost[0][j] = j ? -1 : 0;
+
+	for (int g = 1; g <= num_groups; g++) {
+		for (int j = 0; j <= num_chars; j++) {
+			cost[g][j] = -1;
+			for (int i = 0; i < j; i++) {
+				if (cost[g - 1][i] < 0)
+					continue;
+
+				long total = cost[g - 1][i] + group_cost[i][j];
+				if (cost[g][j] < 0 || total < cost[g][j])
+					cost[g][j] = total, split[g][j] = i;
+			}
+		}
+	}
+
+	for (int g = num_groups, j = num_chars; g > 0; g--) {
+		int i = split[g][j];
+		centers[g - 1] = median[i][j];
+		j = i;
+	}
+}
+
+/* prints from temp_cells + 1 onwards, with temp_cells as the loop counter */
+#define NUM_STRING_CELLS (NUM_SCRATCH_CELLS - 1)
+
+void emit_print_string(Token* tok)
+{
+	const unsigned char* str = (const unsigned char*)tok->value;
+	int counts[256] = { 0 }, num_chars = 0;
+
+	for (int i = 0; i < tok->data; i++)
+		if (!counts[str[i]]++)
+			num_chars++;
+
+	if (!num_chars)
+		return;
+
+	Candidate best = { 0 };
+	unsigned best_values[NUM_STRING_CELLS];
+	int best_cells = 0;
+
+	for (int num_cells = 1; num_cells <= NUM_STRING_CELLS && num_cells <= num_chars; num_cells++) {
+		unsigned centers[NUM_STRING_CELLS];
+		int cells[NUM_STRING_CELLS];
+		cluster_characters(counts, num_cells, centers);
+
+		for (int factor = 0; factor <= 16; factor++) {
+			if (factor == 1)
+				continue;
+
+			unsigned values[NUM_STRING_CELLS];
+			Candidate c;
+			candidate_init(&c, temp_cells);
+
+			for (int i = 0; i < num_cells; i++) {
+				cells[i] = temp_cells + 1 + i;
+				values[i] = candidate_prepare(&c, cells[i]);
+			}
+			if (factor)
+				candidate_clear(&c, temp_cells);
+
+			seed_cells(&c, temp_cells, cells, values, centers, num_cells, factor);
+
+			for (int i = 0; i < tok->data; i++) {
+				int nearest = 0, nearest_cost = -1;
+				for (int j = 0; j < num_cells; j++) {
+					int cost = abs(cells[j] - c.pos) + cheapest_add(str[i] - values[j]);
+					if (nearest_cost < 0 || cost < nearest_cost)
+						nearest = j, nearest_cost = cost;
+				}
+
+				candidate_move_to(&c, cells[nearest]);
+				candidate_add(&c, str[i] - values[nearest]);
+				candidate_emit(&c, ".");
+				values[nearest] = str[i];
+			}
+
+			if (pick_candidate(&best, &c)) {
+				memcpy(best_values, values, sizeof(values));
+				best_cells = num_cells;
+			}
+		}
+	}
+
+	emit_candidate(&best);
+
+	sync_tracker();
+	for (int i = 0; i < best_cells; i++)
+		set_tracked_cell(temp_cells + 1 + i, best_values[i]);
+}
+
+/* sets the cells to the targets, either directly or with a loop shared by
+ * all of them, and leaves the pointer at the first cell */
+void emit_write_cells(const int* cells, const unsigned* targets, int n)
+{
+	if (n <= 0)
+		return;
+
+	int start = cells[0];
+	unsigned* values = bfm_malloc(n * sizeof(unsigned));
+
+	/* the counter has to be outside of the cells */
+	int counter = temp_cells;
+	for (int i = 0; i < n; i++) {
+		if (cells[i] == counter) {
+			counter++;
+			i = -1;
+		}
+	}
+
+	Candidate best = { 0 };
+
+	for (int factor = 0; factor <= 16; factor++) {
+		if (factor == 1)
+			continue;
+
+		Candidate c;
+		candidate_init(&c, start);
+
+		for (int i = 0; i < n; i++)
+			values[i] = candidate_prepare(&c, cells[i]);
+		if (factor)
+			candidate_clear(&c, counter);
+
+		seed_cells(&c, counter, cells, values, targets, n, factor);
+		seed_cells(&c, counter, cells, values, targets, n, 0);
+		candidate_move_to(&c, start);
+
+		pick_candidate(&best, &c);
+	}
+
+	emit_candidate(&best);
+
+	sync_tracker();
+	for (int i = 0; i < n; i++)
+		set_tracked_cell(cells[i], targets[i]);
+
+	free(values);
+}
+
+/* the cells of count elements of an array from first on, which only follow
+ * each other within a block or group */
+int* element_cells(int var_index, int first, int count)
+{
+	int* cells = bfm_malloc((count + 1) * sizeof(int));
+	for (int i = 0; i < count; i++)
+		cells[i] = array_element(var_index, first + i);
+
+	return cells;
+}
+
+void emit_write_string(const int* cells, Token* tok)
+{
+	const unsigned char* str = (const unsigned char*)tok->value;
+	unsigned* targets = bfm_malloc((tok->data + 1) * sizeof(unsigned));
+
+	for (int i = 0; i < tok->data; i++)
+		targets[i] = str[i];
+
+	emit_write_cells(cells, targets, tok->data);
+	free(targets);
+}
+
+void parse_lefthand_side(Token** token, int* left, int* left_index, int* array)
+{
+	Token* tok = *token;
+
+	*left_index = get_variable_index(tok->value);
+	SYNTAX_ASSERT(*left_index == -1, "expected an a variable identifier.")
+
+	if (variables[*left_index].type == VAR_ARRAY) {
+		*array = 1;
+		EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
+		NEXT_TOKEN(tok)
+
+		/* now get the index value, we must account for variables and constants.
+		 * elements at a constant index are used where they rest. */
+		int walk = parse_subscript(&tok, *left_index, temp_x_index, array_upper(*left_index, 0), left);
+		if (walk < 0) {
+			*token = tok;
+			return;
+		}
+
+		*array = walk;
+		if (walk) {
+			emit_array_read(*left_index, temp_x, temp_x_index, array_upper(*left_index, 0));
+			*left = temp_x;
+		}
+	} else {
+		*left = variables[*left_index].location;
+	}
+
+	*token = tok;
+}
+
+/* an operation on a var16 or var32. the right hand side can be a cell
+ * variable of any width, an array element or a constant. */
+void parse_wide_operation(Token** token, int left_index)
+{
+	Token* tok = *token;
+	int x = variables[left_index].location, n = variables[left_index].num_elements;
+
+	NEXT_TOKEN(tok)
+	SYNTAX_ASSERT(tok->type != TOK_OPERATOR, "expected a valid operator.")
+
+	int operation = tok->data;
+	SYNTAX_ASSERT(operation != MOP_EQU && operation != MOP_ADD && operation != MOP_SUB && operation != MOP_MUL
+	        && operation != MOP_EQUEQU && operation != MOP_LESS && operation != MOP_MORE,
+	        "var16 and var32 only support =, +, -, *, ==, < and >.")
+	NEXT_TOKEN(tok)
+
+	int y = -1, y_cells = 0, right_index = get_variable_index(tok->value);
+	unsigned long long k = 0;
+
+	if (tok->type == TOK_IDENTIFIER && right_index != -1) {
+		if (variables[right_index].type == VAR_ARRAY) {
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
+			NEXT_TOKEN(tok)
+
+			int walk = parse_subscript(&tok, right_index, temp_y_index, array_upper(right_index, 1), &y);
+			if (walk < 0) {
+				*token = tok;
+				return;
+			}
+
+			if (walk) {
+				emit_array_read(right_index, temp_y, temp_y_index, array_upper(right_index, 1));
+				y = temp_y;
+			}
+			y_cells = 1;
+		} else {
+			y = variables[right_index].location;
+			y_cells = variables[right_index].num_elements;
+		}
+	} else {
+		k = (long long)expression(&tok);
+		EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+	}
+
+	int reg = wide_cell(1, 0);
+	switch (operation) {
+		case MOP_EQU:
+			for (int i = 0; i < n && y != x; i++) {
+				if (y < 0)
+					set_cell_to_constant(x + i, wide_byte(k, i));
+				else if (i < y_cells)
+					emit_algo(ALGO_EQU, x + i, y + i, -1);
+				else
+					clear_cell(x + i);
+			}
+			break;
+		case MOP_ADD:
+		case MOP_SUB:
+			emit_wide_add(x, n, y, y_cells, k, operation == MOP_SUB, 0);
+			break;
+		case MOP_MUL:
+			emit_wide_mul(x, n, y, y_cells, k);
+			break;
+		default:
+			/* compares want the right hand side in cells apart from x */
+			if (y < 0 || y == x) {
+				for (int i = 0; i < n; i++) {
+					if (y < 0)
+						set_cell_to_constant(reg + i, wide_byte(k, i));
+					else
+						emit_algo(ALGO_EQU, reg + i, x + i, -1);
+				}
+				y = reg, y_cells = n;
+			}
+
+			emit_wide_compare(operation, x, n, y, y_cells);
+
+			if (y == reg)
+				for (int i = 0; i < n; i++)
+					clear_cell(reg + i);
+	}
+
+	*token = tok;
+}
+
+void parse_operation(Token** token)
+{
+	Token* tok = *token;
+
+	int left = 0, operation = 0,
+	        right = 0,
+	        array = 0; /* if the lefthand side is an array, we need to ferry
+                            * the new value to the original location. */
+
+	int left_index = 0;
+	parse_lefthand_side(&tok, &left, &left_index, &array);
+
+	if (left_index != -1 && variables[left_index].type == VAR_CELL && variables[left_index].num_elements > 1) {
+		parse_wide_operation(&tok, left_index);
+		*token = tok;
+		return;
+	}
+
+	NEXT_TOKEN(tok)
+	SYNTAX_ASSERT(tok->type != TOK_OPERATOR, "expected a valid operator.")
+
+	operation = tok->data;
+
+	int algo;
+	switch (operation) {
+		case MOP_EQU:    algo = ALGO_EQU;  break;
+		case MOP_MOD:    algo = ALGO_MOD;  break;
+		case MOP_EQUEQU: algo = ALGO_CEQU; break;
+		case MOP_ADD:    algo = ALGO_ADD;  break;
+		case MOP_SUB:    algo = ALGO_SUB;  break;
+		case MOP_OROR:   algo = ALGO_OR;   break;
+		case MOP_DIV:    algo = ALGO_DIV;  break;
+		case MOP_MUL:    algo = ALGO_MUL;  break;
+		case MOP_ANDAND: algo = ALGO_AND;  break;
+		case MOP_LESS:   algo = ALGO_LESS; break;
+		case MOP_MORE:   algo = ALGO_GRT;  break;
+		default:
+			push_error(tok->origin, 1, 1, "unrecognized operator.");
+			return;
+	}
+
+	/* a var16 on 32 bit cells is brought back to 16 bits after anything that
+	 * can take it past them */
+	int bits = !array && left_index != -1 ? variables[left_index].bits : 0;
+	int wraps = bits && (operation == MOP_ADD || operation == MOP_SUB || operation == MOP_MUL || operation == MOP_EQU);
+
+#define FERRY_ARRAY_BACK                                                                           \
+	if (array) {                                                                               \
+		/* x(y) = z (array write) */                                                       \
+		emit_array_write(left_index, temp_x_index, array_upper(left_index, 0), temp_x);    \
+	} else if (wraps) {                                                                        \
+		emit_constant_algo(MOP_MOD, left, 1u << bits);                                     \
+	}
+
+	NEXT_TOKEN(tok)
+
+	int right_index = get_variable_index(tok->value);
+
+	if (tok->type == TOK_IDENTIFIER && right_index != -1) {
+		if (variables[right_index].type == VAR_ARRAY) {
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
+			NEXT_TOKEN(tok)
+
+			int walk = parse_subscript(&tok, right_index, temp_y_index, array_upper(right_index, 1), &right);
+			if (walk < 0) {
+				*token = tok;
+				return;
+			}
+
+			if (walk) {
+				emit_array_read(right_index, temp_y, temp_y_index, array_upper(right_index, 1));
+				right = temp_y;
+			} else if (right == left) {
+				emit_algo(ALGO_EQU, temp_y, right, -1);
+				right = temp_y;
+			}
+		} else {
+			if (left_index == right_index) {
+				emit_algo(ALGO_EQU, temp_y, variables[right_index].location, -1);
+				right = temp_y;
+			} else {
+				right = variables[right_index].location;
+			}
+
+			/* a variable as narrow is already in range */
+			if (operation == MOP_EQU && variables[right_index].bits && variables[right_index].bits <= bits)
+				wraps = 0;
+		}
+
+		/* x - y starts from x + 2^bits, so that it doesn't go below zero
+		 * and leave the mask to count down from the top of the cell */
+		if (bits && operation == MOP_SUB) {
+			set_cell_to_constant(temp_cells + 1, 1u << bits);
+			emit_template("1[x+1-]", left, -1, -1);
+		}
+	} else {
+		long long a = expression(&tok);
+		EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+
+		/* constants wrap at the variable's width, and taking one away is
+		 * adding what's left of 2^bits */
+		if (bits) {
+			a &= (1ll << bits) - 1;
+			if (operation == MOP_SUB)
+				a = -a & ((1ll << bits) - 1), operation = MOP_ADD;
+			if (operation == MOP_EQU)
+				wraps = 0;
+		}
+
+		if (operation == MOP_SUB) {
+			set_cell_to_constant(temp_y, a);
+			move_pointer_to(temp_y), emit("["), move_pointer_to(left), emit("-"), move_pointer_to(temp_y), emit("-]");
+			*token = tok;
+			FERRY_ARRAY_BACK
+			return;
+		} else if (operation == MOP_ADD) {
+			set_cell_to_constant(temp_y, a);
+			move_pointer_to(temp_y), emit("["), move_pointer_to(left), emit("+"), move_pointer_to(temp_y), emit("-]");
+			*token = tok;
+			FERRY_ARRAY_BACK
+			return;
+		} else if (operation == MOP_EQU) {
+			set_cell_to_constant(left, a);
+
+			*token = tok;
+			FERRY_ARRAY_BACK
+			return;
+		} else if (emit_constant_algo(operation, left, a)) {
+			*token = tok;
+			FERRY_ARRAY_BACK
+			return;
+		} else {
+			set_cell_to_constant(temp_y, a);
+
+			right = temp_y;
+		}
+	}
+
+	emit_algo(algo, left, right, -1);
+	FERRY_ARRAY_BACK
+
+	*token = tok;
+}
+
+enum {
+	STACK_WHILE,
+	STACK_IF,
+	STACK_MACRO
+};
+
+int* stack = NULL;
+int stack_ptr = 0, stack_allocated = 0;
+
+void push_stack(int value)
+{
+	if (stack_ptr == stack_allocated) {
+		stack_allocated = stack_allocated ? 2 * stack_allocated : 256;
+		stack = bfm_realloc(stack, stack_allocated * sizeof(int));
+	}
+	stack[stack_ptr++] = value;
+}
+
+char** parse_list(Token** token, int* count, int** origins)
+{
+	Token* tok = *token, *first = tok;
+
+	*count = 0;
+	char** args = arena_alloc(&compile_arena, sizeof(char*));
+	while (tok->type == TOK_IDENTIFIER && tok->next != NULL && tok->next->type == TOK_OPERATOR) {
+		args = arena_grow(&compile_arena, args, sizeof(char*) * (*count ? *count : 1), sizeof(char*) * (*count + 1));
+		args[(*count)++] = tok->value;
+		
+		if (!tok->next) {
+			push_error(tok->origin, 1, 1, "expected a valid token to follow.");
+			*token = tok;
+			return NULL;
+		}
+		tok = tok->next;
+
+		if (tok->data == MOP_RBRACE) {
+			break;
+		} else if (tok->data != MOP_COMMA) {
+			push_error(tok->origin, 1, 1, "expected a \",\".");
+			*token = tok;
+			break;
+		} else {
+			if (!tok->next) {
+				push_error(tok->origin, 1, 1, "expected a valid token to follow.");
+				*token = tok;
+				return NULL;
+			}
+			tok = tok->next;
+		}
+	}
+
+	/* the names are every other token of the list */
+	if (origins) {
+		*origins = arena_alloc(&compile_arena, sizeof(int) * (*count ? *count : 1));
+		for (int i = 0; i < *count; i++, first = first->next->next)
+			(*origins)[i] = first->origin;
+	}
+
+	*token = tok;
+	return args;
+}
+
+Token** tok_stack = NULL;
+int tok_sp = 0, tok_stack_allocated = 0;
+
+void push_token(Token* tok)
+{
+	if (tok_sp == tok_stack_allocated) {
+		tok_stack_allocated = tok_stack_allocated ? 2 * tok_stack_allocated : 256;
+		tok_stack = bfm_realloc(tok_stack, tok_stack_allocated * sizeof(Token*));
+	}
+	tok_stack[tok_sp++] = tok;
+}
+
+/* a variable declared in a loop keeps its value from one iteration to the
+ * next, so its cells are cleared each time the loop is entered instead of
+ * where it's declared */
+void clear_loop_slots()
+{
+	Frame* frame = &frames[num_frames - 1];
+	Summary* summary = frame->summary;
+
+	frame->open_loops++;
+	if (frame->next_loop == summary->num_loops)
+		return;
+
+	int loop = frame->next_loop++;
+	for (int i = summary->loop_clears[loop]; i < summary->loop_clears[loop + 1]; i++) {
+		Site site = summary->clears[i];
+		FrameSlot* slot = &frame_slots[frame->first_slot + site.slot];
+
+		if (site.reused || !slot->fresh)
+			for (int j = 0; j < summary->widths[site.slot]; j++)
+				clear_cell(slot->location + j);
+	}
+}
+
+void parse_keyword(Token** token)
+{
+	Token* tok = *token;
+
+	switch (tok->data) {
+		case KYWRD_VAR:
+		case KYWRD_VAR16:
+		case KYWRD_VAR32: {
+			int keyword = tok->data, cells = variable_cells(keyword);
+			NEXT_TOKEN(tok)
+
+			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
+			SYNTAX_ASSERT(get_keyword(tok->value) != -1, "variable names must not be keywords.")
+
+			int fresh, location = take_site(&fresh);
+			add_variable(tok->value, cells, VAR_CELL, location, context, tok->origin, scope, ARRAY_WALK);
+			variables[num_variables - 1].bits = variable_bits(keyword);
+
+			/* a variable starts out zero, even in a cell another one used */
+			if (!fresh)
+				for (int i = 0; i < cells; i++)
+					clear_cell(location + i);
+		} break;
+		case KYWRD_WHILE: {
+			NEXT_TOKEN(tok)
+
+			int var_index = get_variable_index(tok->value);
+			
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for while statements must not be arrays.")
+			SYNTAX_ASSERT(variables[var_index].num_elements > 1, "arguments for while statements must be one cell, compare a var16 or var32 into a var.")
+
+			clear_loop_slots();
+
+			int variable_location = variables[var_index].location;
+			move_pointer_to(variable_location);
+			emit("[");
+
+			push_stack(variable_location);
+			push_stack(STACK_WHILE);
+
+			scope++;
+			
+		} break;
+		case KYWRD_END: {
+			SYNTAX_ASSERT(stack_ptr < 1, "unmatched end statement.")
+
+			kill_variables_of_scope(scope--);
+			switch (stack[--stack_ptr]) {
+				case STACK_WHILE:
+					move_pointer_to(stack[--stack_ptr]);
+					emit("]");
+					frames[num_frames - 1].open_loops--;
+					break;
+				case STACK_IF:
+					move_pointer_to(stack[--stack_ptr]);
+					emit("[-]]");
+					break;
+				case STACK_MACRO:
+					tok = tok_stack[--tok_sp];
+					stack_ptr--;
+					kill_variables_of_context(context--);
+					current_expansion = expansions[current_expansion].parent;
+					pop_frame();
+					break;
+			}
+
+			sync_tracker();
+		} break;
+		case KYWRD_GOTO: {
+			NEXT_TOKEN(tok)
+
+			int var_index = get_variable_index(tok->value);
+
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+
+			int variable_location = variables[var_index].location;
+			move_pointer_to(variable_location);
+		}  break;
+		case KYWRD_IF: {
+			NEXT_TOKEN(tok)
+
+			int var_index = get_variable_index(tok->value);
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for if statements must not be arrays.")
+
+			int variable_location = variables[var_index].location;
+			
+			emit_algo(ALGO_EQU, temp_x, variable_location, -1);
+			for (int i = 1; i < variables[var_index].num_elements; i++)
+				emit_algo(ALGO_OR, temp_x, variable_location + i, -1);
+			move_pointer_to(temp_x);
+			emit("[");
+
+			push_stack(temp_x);
+			push_stack(STACK_IF);
+
+			scope++;
+		} break;
+		case KYWRD_NOT: {
+			NEXT_TOKEN(tok)
+
+			int var_index = get_variable_index(tok->value);
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for not statements must not be arrays.")
+
+			int variable_location = variables[var_index].location;
+			for (int i = 1; i < variables[var_index].num_elements; i++) {
+				emit_algo(ALGO_OR, variable_location, variable_location + i, -1);
+				clear_cell(variable_location + i);
+			}
+			emit_algo(ALGO_NOT, variable_location, -1, -1);
+		} break;
+		case KYWRD_PRINT: {
+				NEXT_TOKEN(tok)
+
+				int var_index = get_variable_index(tok->value);
+				if (tok->type == TOK_STRING) {
+					emit_print_string(tok);
+				} else if (tok->type == TOK_IDENTIFIER && var_index != -1) {
+					int left = 0;
+					if (variables[var_index].type == VAR_ARRAY) {
+						EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
+						NEXT_TOKEN(tok)
+
+						int walk = parse_subscript(&tok, var_index, temp_y_index, array_upper(var_index, 1), &left);
+						if (walk < 0) {
+							*token = tok;
+							return;
+						}
+
+						if (walk) {
+							emit_array_read(var_index, temp_y, temp_y_index, array_upper(var_index, 1));
+							left = temp_y;
+						}
+					} else if (variables[var_index].num_elements > 1) {
+						emit_wide_print(variables[var_index].location, variables[var_index].num_elements);
+						break;
+					} else {
+						left = variables[var_index].location;
+					}
+
+					emit_algo(ALGO_PRINTV, left, -1, -1);
+				} else {
+					long long a = expression(&tok);
+					EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+					
+					set_cell_to_constant(temp_cells, a);
+					emit(".");
+				}
+			} break;
+		case KYWRD_ARRAY: {
+			NEXT_TOKEN(tok)
+			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
+			char* name = tok->value;
+			NEXT_TOKEN(tok)
+
+			int a = expression(&tok);
+			SYNTAX_ASSERT(a < 1, "arrays must have at least one element.")
+
+			/* the layout can be given after the size, otherwise it's estimated */
+			int layout = -1;
+			if (tok->next && tok->next->type == TOK_IDENTIFIER) {
+				NEXT_TOKEN(tok)
+				for (int i = 0; i < NUM_ARRAY_LAYOUTS; i++)
+					if (!strcmp(tok->value, array_layouts[i]))
+						layout = i;
+				SYNTAX_ASSERT(layout == -1, "unknown array layout.")
+			} else {
+				layout = choose_array_layout(a, count_variable_subscripts(tok, name));
+			}
+
+			EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+			add_variable(name, a, VAR_ARRAY, arrays + used_array_cells, context, tok->origin, scope, layout);
+		} break;
+		case KYWRD_BF: {
+			NEXT_TOKEN(tok)
+			SYNTAX_ASSERT(tok->type != TOK_STRING, "expected a string literal.")
+			emit(tok->value);
+			sync_tracker();
+		} break;
+		case KYWRD_DEFINE: {
+			NEXT_TOKEN(tok)
+			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
+
+			char* name = tok->value;
+			NEXT_TOKEN(tok)
+			SYNTAX_ASSERT(tok->type != TOK_NUMBER, "expected a number.")
+
+			double data = expression(&tok);
+			EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+
+			add_definition(name, (long long)data);
+		} break;
+		case KYWRD_INPUT: {
+			NEXT_TOKEN(tok)
+
+			int var_index = get_variable_index(tok->value);
+
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for input statements must not be arrays.")
+
+			/* a character only reaches the low cell of a var16 or var32 */
+			for (int i = 1; i < variables[var_index].num_elements; i++)
+				clear_cell(variables[var_index].location + i);
+
+			move_pointer_to(variables[var_index].location);
+			emit(",");
+		} break;
+		case KYWRD_WRITE: {
+			NEXT_TOKEN(tok)
+
+			/* either at the pointer, or into an array starting at a constant index */
+			int first = -1, var_index = get_variable_index(tok->value);
+			if (tok->type == TOK_IDENTIFIER && var_index != -1) {
+				SYNTAX_ASSERT(variables[var_index].type != VAR_ARRAY, "expected an array.")
+				EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
+				NEXT_TOKEN(tok)
+
+				first = expression(&tok);
+				EXPECT_TOKEN(tok, TOK_OPERATOR, "]")
+				NEXT_TOKEN(tok)
+				SYNTAX_ASSERT(tok->type != TOK_STRING, "expected a string.")
+				SYNTAX_ASSERT(first < 0 || first + tok->data > variables[var_index].num_elements,
+				              "the string doesn't fit into the array.")
+			}
+
+			SYNTAX_ASSERT(tok->type != TOK_STRING, "expected a string.")
+
+			int* cells;
+			if (first == -1) {
+				cells = bfm_malloc((tok->data + 1) * sizeof(int));
+				for (int i = 0; i < tok->data; i++)
+					cells[i] = cell_pointer + i;
+			} else {
+				cells = element_cells(var_index, first, tok->data);
+			}
+
+			emit_write_string(cells, tok);
+			free(cells);
+		} break;
+		case KYWRD_FILL: {
+			NEXT_TOKEN(tok)
+			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
+			int var_index = get_variable_index(tok->value);
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+			SYNTAX_ASSERT(variables[var_index].type != VAR_ARRAY, "expected an array.")
+
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
+			NEXT_TOKEN(tok)
+			int first = expression(&tok);
+			EXPECT_TOKEN(tok, TOK_OPERATOR, ",")
+			NEXT_TOKEN(tok)
+			int count = expression(&tok);
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "]")
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "=")
+			NEXT_TOKEN(tok)
+			long long value = expression(&tok);
+			EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+
+			SYNTAX_ASSERT(first < 0 || count < 0 || first + count > variables[var_index].num_elements,
+			              "the range doesn't fit into the array.")
+
+			unsigned* targets = bfm_malloc((count + 1) * sizeof(unsigned));
+			for (int i = 0; i < count; i++)
+				targets[i] = value & cell_mask;
+
+			int* cells = element_cells(var_index, first, count);
+			emit_write_cells(cells, targets, count);
+			free(targets);
+			free(cells);
+		} break;
+		case KYWRD_DECIM: {
+			NEXT_TOKEN(tok)
+			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
+			int var_index = get_variable_index(tok->value);
+			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for decimal statements must not be arrays.")
+
+			Variable* var = &variables[var_index];
+			if (var->num_elements > 1) {
+				emit_wide_decimal(var->location, var->num_elements);
+			} else {
+				emit_algo(ALGO_DECIM, var->location, -1, -1);
+				if (var->bits)
+					emit_constant_algo(MOP_MOD, var->location, 1u << var->bits);
+			}
+		} break;
+		case KYWRD_MACRO: {
+			NEXT_TOKEN(tok)
+			
+			if (tok->type != TOK_IDENTIFIER)
+				push_error(tok->origin, 1, 1, "expected an identifier.");
+
+			char* name = tok->value;
+			int origin = tok->origin;
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
+			NEXT_TOKEN(tok)
+
+			int count = 0;
+			int* origins = NULL;
+			char** args = parse_list(&tok, &count, &origins);
+			SYNTAX_ASSERT(!args, "malformed argument list.")
+
+			if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
+				push_error(tok->origin, 1, 1, "expected \")\".");
+			}
+			NEXT_TOKEN(tok)
+			Token* body = tok;
+
+			add_macro(name, args, count, body, origin, origins);
+
+			int depth = 1;
+			while (tok) {
+				if (tok->type == TOK_KYWRD) {
+					if (tok->data == KYWRD_IF || tok->data == KYWRD_WHILE) {
+						depth++;
+					} else if (tok->data == KYWRD_END) {
+						depth--;
+					}
+				} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_MACRO) {
+					depth++;
+				}
+
+				if (!depth)
+					break;
+
+				tok = tok->next;
+			}
+
+			if (depth) {
+				push_error(origin, 0, 1, "no terminating end statement to macro definition.");
+				tok = body;
+				*token = tok;
+				return;
+			}
+
+			// printf("found a macro called %s with %d arguments.\n", name, count);
+		} break;
+	}
+
+	*token = tok;
+}
+
+/* TODO: change the error system so the we can report both the location of a problematic
+ * macro and the expansion that caused the issue. */
+void parse_macro(Token** token)
+{
+	Token* tok = *token;
+
+	int macro_idx = get_macro_index(tok->value);
+
+	for (int i = stack_ptr - 1; i >= 1; i -= 2) {
+		if (stack[i] == STACK_MACRO && stack[i - 1] == macro_idx) {
+			push_error(macros[macro_idx].origin, 0, 1, "recursive macro definition.");
+			int num_args = 0;
+			EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
+			NEXT_TOKEN(tok)
+			parse_list(&tok, &num_args, NULL);
+
+			if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
+				push_error(tok->origin, 0, 1, "expected \")\".");
+			}
+
+			*token = tok->next;
+
+			return;
+		}
+	}
+
+	EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
+	NEXT_TOKEN(tok)
+	
+	int num_args = 0;
+	char** args = parse_list(&tok, &num_args, NULL);
+
+	if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
+		push_error(tok->origin, 1, 1, "expected \")\".");
+	}
+
+	SYNTAX_ASSERT(!args, "malformed argument list.")
+	SYNTAX_ASSERT(num_args != macros[macro_idx].num_args, "incorrect number of arguments to macro.")
+	push_token(tok);
+	push_stack(macro_idx);
+	push_stack(STACK_MACRO);
+	push_expansion(macro_idx);
+	scope++;
+
+	Frame* caller = &frames[num_frames - 1];
+	push_frame(summary_of(macro_idx, caller->summary->looped || caller->open_loops));
+
+	int failed = 0;
+	for (int i = 0; i < num_args; i++) {
+		int arg_idx = get_variable_index(args[i]);
+		if (arg_idx == -1) {
+			push_error(tok->origin, 0, 1, "unrecognized variable.");
+			failed = 1;
+			continue;
+		}
+		alias_variable(macros[macro_idx].args[i], arg_idx, context + 1, macros[macro_idx].origins[i]);
+	}
+
+	if (failed) {
+		*token = tok;
+		return;
+	}
+
+	context++;
+	tok = macros[macro_idx].body;
+
+	*token = tok;
+}
+
+void parse(Token* tok)
+{
+	push_frame(&program_summary);
+
+	while (tok) {
+		current_origin = tok->origin;
+
+		if (tok->type == TOK_KYWRD) {
+			parse_keyword(&tok);
+			tok = tok->next;
+		} else if (tok->type == TOK_IDENTIFIER && get_variable_index(tok->value) != -1) {
+			parse_operation(&tok);
+			tok = tok->next;
+		} else if (tok->type == TOK_IDENTIFIER && get_macro_index(tok->value) != -1) {
+			parse_macro(&tok);
+		} else {
+			push_error(tok->origin, 1, 1, "invalid statement.", tok->value);
+			tok = tok->next;
+		}
+	}
+	kill_variables_of_scope(scope--);
+
+	check_errors();
+}
+
+char* binding_name(int i) { return bindings[i].name; }
+SymbolTable binding_table = { .name_of = binding_name };
+int bindings_allocated = 0;
+
+void bind_name(char* name, int declaration, int ctx, int bind_scope)
 {
-	char mem[64], stack[64];
-	int ip = 0, mp = 0, sp = 0;
+	if (num_bindings == bindings_allocated) {
+		bindings_allocated = bindings_allocated ? 2 * bindings_allocated : 256;
+		bindings = bfm_realloc(bindings, bindings_allocated * sizeof(Binding));
+	}
 
-	for (int i = 0; i < 64; i++) mem[i] = 0, stack[i] = 0;
+	bindings[num_bindings] = (Binding){ name, declaration, ctx, bind_scope };
+	insert_symbol(&binding_table, num_bindings++, name);
+}
 
-	while (code[ip]) {
-		switch (code[ip]) {
-			case '-': mem[mp]--; break;
-			case '+': mem[mp]++; break;
-			case '[': {
-				if (mem[mp]) {
-					stack[sp++] = ip;
-				} else {
-					int depth = 1;
-					do {
-						ip++;
-						if (code[ip] == '[') depth++;
-						else if (code[ip] == ']') depth--;
-					} while (depth);
-				}
-			} break;
-			case ']': ip = stack[--sp] - 1; break;
-			case '<': mp--; break;
-			case '>': mp++; break;
+/* the newest binding of the name in the context */
+int find_binding(char* name, int ctx)
+{
+	for (int i = first_symbol(&binding_table, name); i != -1; i = binding_table.older[i])
+		if (bindings[i].ctx == ctx && bindings[i].name == name)
+			return i;
+	return -1;
+}
+
+/* weights multiply through loops in nested macros, so they're capped */
+#define MAX_WEIGHT (1L << 30)
+
+long scale_weight(long weight, long factor)
+{
+	return factor && weight > MAX_WEIGHT / factor ? MAX_WEIGHT : weight * factor;
+}
+
+int push_declaration(int cells, int clock, int depth)
+{
+	declarations = bfm_realloc(declarations, (num_declarations + 1) * sizeof(Declaration));
+	declarations[num_declarations] = (Declaration){ cells, clock, clock, 0, 0, -1, depth, -1, 0 };
+	return num_declarations++;
+}
+
+void add_adjacency(int a, int b, long weight)
+{
+	adjacencies = bfm_realloc(adjacencies, (num_adjacencies + 1) * sizeof(Adjacency));
+	adjacencies[num_adjacencies++] = (Adjacency){ a, b, weight };
+}
+
+/* the pointer travels from the last declaration used to this one */
+void note_travel(int declaration, long weight)
+{
+	if (last_use >= 0 && last_use != declaration)
+		add_adjacency(last_use, declaration, weight);
+
+	if (first_use < 0)
+		first_use = declaration;
+	last_use = declaration;
+}
+
+/* whether the use of a variable at the token sets it, without reading it,
+ * every time its declaration is reached */
+int sets_variable(Token* tok, int declaration, int ctx, int depth)
+{
+	Token* next = tok->next;
+	if (declarations[declaration].depth != depth || !next || next->type != TOK_OPERATOR
+	        || next->data != MOP_EQU || !next->next)
+		return 0;
+
+	/* a constant, or another variable */
+	int binding = next->next->type == TOK_IDENTIFIER ? find_binding(next->next->value, ctx) : -1;
+	return binding == -1 || (bindings[binding].declaration >= 0 && bindings[binding].declaration != declaration);
+}
+
+void note_use(int declaration, int clock, long weight)
+{
+	if (declaration < 0)
+		return;
+
+	Declaration* d = &declarations[declaration];
+	if (d->first_read < 0)
+		d->first_read = 1;
+
+	d->end = clock > d->end ? clock : d->end;
+	d->weight += weight;
+
+	note_travel(declaration, weight);
+}
+
+/* where the cells of the slots in order are, the first being next to the temps */
+void place_slots(int* order, int num_slots, int* widths, int* locations, int total)
+{
+	for (int i = 0; i < num_slots; i++) {
+		total -= widths[order[i]];
+		locations[order[i]] = total;
+	}
+}
+
+long layout_cost(int* order, int num_slots, int* widths, int* locations, long* weights, long* temp_weights, int total)
+{
+	place_slots(order, num_slots, widths, locations, total);
+
+	long cost = 0;
+	for (int a = 0; a < num_slots; a++) {
+		cost += temp_weights[a] * (total + 4 - locations[a]);
+		for (int b = a + 1; b < num_slots; b++)
+			cost += weights[a * num_slots + b] * abs(locations[a] - locations[b]);
+	}
+
+	return cost;
+}
+
+/* gives the declarations of one walk, from the first one given on, their
+ * slots, and returns how many slots there are */
+int assign_slots(int first_declaration, int first_loop, int** widths)
+{
+	int num_slots = 0, *occupant = NULL;
+	*widths = NULL;
+
+	/* a variable declared in a loop keeps its value from one iteration to the
+	 * next, so one that's read before it's set lives for the whole loop */
+	for (int d = first_declaration; d < num_declarations; d++) {
+		Declaration* decl = &declarations[d];
+		for (int l = first_loop; l < num_loops && decl->cells; l++)
+			if (loops[2 * l] < decl->start && loops[2 * l + 1] >= decl->start
+			        && (decl->loop < 0 || loops[2 * l] > loops[2 * decl->loop]))
+				decl->loop = l;
+
+		if (decl->loop >= 0 && decl->first_read == 1) {
+			decl->start = loops[2 * decl->loop];
+			decl->end = decl->end > loops[2 * decl->loop + 1] ? decl->end : loops[2 * decl->loop + 1];
 		}
+	}
 
-		ip++;
+	/* a variable that's used in a loop it wasn't declared in lives until the
+	 * loop ends, as it's used again in the next iteration */
+	for (int changed = 1; changed;) {
+		changed = 0;
+		for (int d = first_declaration; d < num_declarations; d++)
+			for (int l = first_loop; l < num_loops; l++)
+				if (loops[2 * l] > declarations[d].start && loops[2 * l] <= declarations[d].end
+				        && loops[2 * l + 1] > declarations[d].end)
+					declarations[d].end = loops[2 * l + 1], changed = 1;
+	}
+
+	/* linear scan, reusing a slot of the same width once its variable is dead */
+	for (int d = first_declaration; d < num_declarations; d++) {
+		Declaration* decl = &declarations[d];
+		decl->slot = -1;
+
+		if (!decl->cells)
+			continue;
+
+		for (int s = 0; s < num_slots && decl->slot < 0; s++)
+			if ((*widths)[s] == decl->cells && declarations[occupant[s]].end < decl->start)
+				decl->slot = s, decl->reused = 1;
+
+		if (decl->slot < 0) {
+			*widths = bfm_realloc(*widths, (num_slots + 1) * sizeof(int));
+			occupant = bfm_realloc(occupant, (num_slots + 1) * sizeof(int));
+			(*widths)[num_slots] = decl->cells;
+			decl->slot = num_slots++;
+		}
+
+		occupant[decl->slot] = d;
 	}
 
-	return mp;
+	free(occupant);
+	return num_slots;
 }
 
-void clear_cells_right(int num)
+/* orders the program's slots and returns how many cells they take */
+int place_cells(int first_declaration, int first_adjacency, int num_slots, int* widths, int* locations)
 {
-	for (int i = 0; i < num; i++) {
-		emit("[-]>");
+	int total = 0;
+	for (int s = 0; s < num_slots; s++)
+		total += widths[s];
+
+	long* weights = bfm_calloc(num_slots * num_slots + 1, sizeof(long));
+	long* temp_weights = bfm_calloc(num_slots + 1, sizeof(long));
+	int* order = bfm_malloc((num_slots + 1) * sizeof(int));
+	int* placed = bfm_calloc(num_slots + 1, sizeof(int));
+
+	for (int d = first_declaration; d < num_declarations; d++)
+		if (declarations[d].slot >= 0)
+			temp_weights[declarations[d].slot] += declarations[d].weight;
+
+	for (int i = first_adjacency; i < num_adjacencies; i++) {
+		int a = declarations[adjacencies[i].a].slot, b = declarations[adjacencies[i].b].slot;
+		if (a < 0 || b < 0)
+			continue;
+
+		weights[a * num_slots + b] += adjacencies[i].weight;
+		weights[b * num_slots + a] += adjacencies[i].weight;
+	}
+
+	/* place the slots outwards from the temps, each time the one most drawn
+	 * to what's placed already */
+	for (int i = 0; i < num_slots; i++) {
+		long best_pull = -1;
+		for (int s = 0; s < num_slots; s++) {
+			if (placed[s])
+				continue;
+
+			long pull = temp_weights[s];
+			for (int j = 0; j < i; j++)
+				pull += weights[s * num_slots + order[j]];
+
+			if (pull > best_pull)
+				best_pull = pull, order[i] = s;
+		}
+		placed[order[i]] = 1;
 	}
 
-	for (int i = 0; i < num; i++) {
-		emit("<");
+	/* then swap neighbours while that shortens the travel */
+	if (num_slots <= 256) {
+		long cost = layout_cost(order, num_slots, widths, locations, weights, temp_weights, total);
+		for (int pass = 0, improved = 1; pass < 8 && improved; pass++) {
+			improved = 0;
+			for (int i = 0; i + 1 < num_slots; i++) {
+				int t = order[i];
+				order[i] = order[i + 1], order[i + 1] = t;
+
+				long swapped = layout_cost(order, num_slots, widths, locations, weights, temp_weights, total);
+				if (swapped < cost) {
+					cost = swapped, improved = 1;
+				} else {
+					order[i + 1] = order[i], order[i] = t;
+				}
+			}
+		}
 	}
+
+	place_slots(order, num_slots, widths, locations, total);
+
+	free(weights), free(temp_weights), free(order), free(placed);
+	return total;
 }
 
-void set_cell_to_constant(int cell, int value)
+/* declares the slots of an expansion's body at the clock, each a site of the
+ * walk, and uses the caller's variables that its arguments stand for the way
+ * the body does */
+void expand_summary(Summary* callee, Token* tok, int ctx, int clock, long weight, int** site_declarations, int* num_sites)
 {
-	value %= 256;
+	int n = callee->num_args, *mapped = bfm_malloc((n + callee->num_slots + 1) * sizeof(int));
 
-	if (value > 15) {
-		move_pointer_to(temp_cells);
-		clear_cells_right(bf_constants[value].cells_required);
+	for (int i = 0; i < n; i++)
+		mapped[i] = -1;
 
-		emit(bf_constants[value].code);
-		int offset = pointer_offset_interpreter(bf_constants[value].code);
+	Token* arg = tok->next ? tok->next->next : NULL;
+	for (int i = 0; arg && i < n; arg = arg->next) {
+		if (arg->type != TOK_IDENTIFIER)
+			continue;
 
-		for (int i = 0; i < offset; i++) emit("<");
+		int b = find_binding(arg->value, ctx);
+		mapped[i++] = b == -1 ? -1 : bindings[b].declaration;
+	}
 
-		move_pointer_to(cell), emit("[-]"), move_pointer_to(temp_cells + offset);
-		emit("["), move_pointer_to(cell), emit("+"), move_pointer_to(temp_cells + offset), emit("-]");
-	} else {
-		move_pointer_to(cell), emit("[-]"), add(value);
+	/* realloc to zero bytes frees the list */
+	if (callee->num_slots)
+		*site_declarations = bfm_realloc(*site_declarations, (*num_sites + callee->num_slots) * sizeof(int));
+	for (int i = 0; i < callee->num_slots; i++) {
+		(*site_declarations)[(*num_sites)++] = mapped[n + i] = push_declaration(callee->widths[i], clock, 0);
+		declarations[mapped[n + i]].first_read = callee->kept[i];
+	}
+
+	for (int i = 0; i < n + callee->num_slots; i++) {
+		if (mapped[i] < 0)
+			continue;
+
+		Declaration* d = &declarations[mapped[i]];
+		d->end = clock > d->end ? clock : d->end;
+		d->first_read = d->first_read < 0 ? 1 : d->first_read;
+		d->weight = scale_weight(callee->weights[i], weight) + d->weight;
 	}
+
+	for (int i = 0; i < callee->num_adjacencies; i++) {
+		int a = mapped[callee->adjacencies[i].a], b = mapped[callee->adjacencies[i].b];
+		if (a >= 0 && b >= 0 && a != b)
+			add_adjacency(a, b, scale_weight(callee->adjacencies[i].weight, weight));
+	}
+
+	if (callee->first_use >= 0 && mapped[callee->first_use] >= 0)
+		note_travel(mapped[callee->first_use], weight);
+	if (callee->last_use >= 0 && mapped[callee->last_use] >= 0)
+		last_use = mapped[callee->last_use];
+
+	free(mapped);
 }
 
-void parse_lefthand_side(Token** token, int* left, int* left_index, int* array)
+/* what a declaration of the walk is to the summary, the arguments' coming first */
+int summary_entity(int declaration, int first_declaration, int num_args)
 {
-	Token* tok = *token;
+	int i = declaration - first_declaration;
+	return i < num_args ? i : num_args + declarations[declaration].slot;
+}
 
-	*left_index = get_variable_index(tok->value);
-	SYNTAX_ASSERT(*left_index == -1, "expected an a variable identifier.")
+/* whether the loop is inside another, which may have put something else in
+ * the cells of its variables since it was last entered */
+int nested_loop(int loop, int first_loop)
+{
+	for (int l = first_loop; l < num_loops; l++)
+		if (loops[2 * l] < loops[2 * loop] && loops[2 * l + 1] >= loops[2 * loop + 1])
+			return 1;
+	return 0;
+}
 
-	if (variables[*left_index].type == VAR_ARRAY) {
-		*array = 1;
-		EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
-		NEXT_TOKEN(tok)
+/* sums up what the walk of a body found in terms of its arguments and slots */
+void finish_summary(Summary* summary, int num_args, int first_declaration, int first_adjacency, int first_loop, int* site_declarations)
+{
+	int n = num_args + summary->num_slots;
+	long* pairs = bfm_calloc(n * n + 1, sizeof(long));
 
-		/* now get the index value, we must account for variables and constants */
-		int subscript_index = get_variable_index(tok->value);
-		if (tok->type == TOK_IDENTIFIER && subscript_index != -1) {
-			emit_algo(ALGO_EQU, temp_x_index, variables[subscript_index].location, -1);
+	summary->num_args = num_args;
+	summary->weights = memset(arena_alloc(&compile_arena, (n + 1) * sizeof(long)), 0, (n + 1) * sizeof(long));
+
+	for (int d = first_declaration; d < num_declarations; d++) {
+		long* weight = &summary->weights[summary_entity(d, first_declaration, num_args)];
+		*weight = scale_weight(*weight + declarations[d].weight, 1);
+	}
+
+	int num_pairs = 0;
+	for (int i = first_adjacency; i < num_adjacencies; i++) {
+		int a = summary_entity(adjacencies[i].a, first_declaration, num_args);
+		int b = summary_entity(adjacencies[i].b, first_declaration, num_args);
+		if (a == b)
+			continue;
+
+		long* pair = &pairs[a < b ? a * n + b : b * n + a];
+		num_pairs += !*pair;
+		*pair = scale_weight(*pair + adjacencies[i].weight, 1);
+	}
+
+	summary->adjacencies = arena_alloc(&compile_arena, (num_pairs + 1) * sizeof(Adjacency));
+	summary->num_adjacencies = 0;
+	for (int a = 0; a < n; a++)
+		for (int b = a + 1; b < n; b++)
+			if (pairs[a * n + b])
+				summary->adjacencies[summary->num_adjacencies++] = (Adjacency){ a, b, pairs[a * n + b] };
+
+	summary->first_use = first_use < 0 ? -1 : summary_entity(first_use, first_declaration, num_args);
+	summary->last_use = last_use < 0 ? -1 : summary_entity(last_use, first_declaration, num_args);
+
+	/* the loop around a looped body is the caller's, which clears the body's
+	 * slots before it's entered */
+	int first_cleared_loop = first_loop + summary->looped;
+
+	summary->sites = arena_alloc(&compile_arena, (summary->num_sites + 1) * sizeof(Site));
+	summary->kept = memset(arena_alloc(&compile_arena, (summary->num_slots + 1) * sizeof(int)), 0, (summary->num_slots + 1) * sizeof(int));
+	for (int i = 0; i < summary->num_sites; i++) {
+		Declaration* d = &declarations[site_declarations[i]];
+
+		/* a variable that's set before it's read can take any cells, but in a
+		 * loop they aren't known to be zero */
+		if (d->loop >= 0 && d->first_read != 1) {
+			summary->sites[i] = (Site){ d->slot, 1, 0 };
+		} else if (d->loop < first_cleared_loop) {
+			summary->sites[i] = (Site){ d->slot, d->reused, 0 };
+			summary->kept[d->slot] |= d->loop >= 0;
 		} else {
-			int a = expression(&tok);
-			set_cell_to_constant(temp_x_index, a);
+			summary->sites[i] = (Site){ d->slot, 0, 1 };
 		}
+	}
 
-		EXPECT_TOKEN(tok, TOK_OPERATOR, "]")
+	summary->num_loops = num_loops - first_cleared_loop;
+	summary->loop_clears = arena_alloc(&compile_arena, (summary->num_loops + 1) * sizeof(int));
+	summary->clears = arena_alloc(&compile_arena, (num_declarations - first_declaration + 1) * sizeof(Site));
 
-		emit_algo(ALGO_ARRAY_READ, temp_x, variables[*left_index].location, temp_x_index); /* x = y(z) */
-		*left = temp_x;
-	} else {
-		*left = variables[*left_index].location;
+	int num_clears = 0;
+	for (int l = first_cleared_loop; l < num_loops; l++) {
+		summary->loop_clears[l - first_cleared_loop] = num_clears;
+		for (int d = first_declaration + num_args; d < num_declarations; d++)
+			if (declarations[d].loop == l && declarations[d].first_read == 1)
+				summary->clears[num_clears++] = (Site){ declarations[d].slot, declarations[d].reused || nested_loop(l, first_loop), 0 };
 	}
+	summary->loop_clears[summary->num_loops] = num_clears;
 
-	*token = tok;
+	free(pairs);
 }
 
-void parse_operation(Token** token)
+int scope_ptr;
+
+/* walks the program, or the body of a macro up to its end, into its summary.
+ * macros are walked the first time they're expanded. */
+int summarize(Token** token, int macro_idx, int ctx, int looped)
 {
 	Token* tok = *token;
+	int first_declaration = num_declarations, first_adjacency = num_adjacencies, first_loop = num_loops;
+	int stack_base = stack_ptr, clock = 0, loop_depth = 0, binding, callee;
+	int num_args = macro_idx < 0 ? 0 : macros[macro_idx].num_args;
+	int* site_declarations = NULL, num_sites = 0;
+
+	Summary* summary = summary_of(macro_idx, looped);
+	summary->walking = 1;
+	summary->looped = looped;
+	first_use = last_use = -1;
+
+	/* a loop around the whole of a looped body, closed when the walk ends */
+	if (looped) {
+		loops = bfm_realloc(loops, (num_loops + 1) * 2 * sizeof(int));
+		loops[2 * num_loops] = loops[2 * num_loops + 1] = -1;
+		num_loops++;
+	}
 
-	int left = 0, operation = 0,
-	        right = 0,
-	        array = 0; /* if the lefthand side is an array, we need to ferry
-                            * the new value to the original location. */
+	/* the arguments stand for the caller's variables in the body */
+	if (macro_idx >= 0) {
+		scope_ptr++;
+		for (int i = 0; i < num_args; i++)
+			bind_name(macros[macro_idx].args[i], push_declaration(0, 0, 0), ctx, scope_ptr);
+	}
 
-	int left_index = 0;
-	parse_lefthand_side(&tok, &left, &left_index, &array);
+	for (; tok; tok = tok->next, clock++) {
+		long weight = 1L << (3 * (loop_depth < 4 ? loop_depth : 4));
 
-	NEXT_TOKEN(tok)
-	SYNTAX_ASSERT(tok->type != TOK_OPERATOR, "expected a valid operator.")
+		if (tok->type == TOK_KYWRD && (tok->data == KYWRD_VAR || tok->data == KYWRD_VAR16 || tok->data == KYWRD_VAR32)) {
+			int cells = variable_cells(tok->data);
+			widest_variable = cells > widest_variable ? cells : widest_variable;
 
-	operation = tok->data;
+			PARSE_NEXT_TOKEN(tok)
+			site_declarations = bfm_realloc(site_declarations, (num_sites + 1) * sizeof(int));
+			site_declarations[num_sites++] = push_declaration(cells, clock, stack_ptr - stack_base);
+			bind_name(tok->value, num_declarations - 1, ctx, scope_ptr);
+		} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_ARRAY) {
+			PARSE_NEXT_TOKEN(tok)
+			bind_name(tok->value, -1, ctx, scope_ptr);
+		} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_MACRO) {
+			PARSE_NEXT_TOKEN(tok)
+			
+			if (tok->type != TOK_IDENTIFIER)
+				push_error(tok->origin, 1, 1, "expected an identifier.");
 
-	int algo;
-	switch (operation) {
-		case MOP_EQU:    algo = ALGO_EQU;  break;
-		case MOP_MOD:    algo = ALGO_MOD;  break;
-		case MOP_EQUEQU: algo = ALGO_CEQU; break;
-		case MOP_ADD:    algo = ALGO_ADD;  break;
-		case MOP_SUB:    algo = ALGO_SUB;  break;
-		case MOP_OROR:   algo = ALGO_OR;   break;
-		case MOP_DIV:    algo = ALGO_DIV;  break;
-		case MOP_MUL:    algo = ALGO_MUL;  break;
-		case MOP_ANDAND: algo = ALGO_AND;  break;
-		case MOP_LESS:   algo = ALGO_LESS; break;
-		case MOP_MORE:   algo = ALGO_GRT;  break;
-		default:
-			push_error(tok->origin, 1, 1, "unrecognized operator.");
-			return;
-	}
+			char* name = tok->value;
+			int origin = tok->origin;
+			PARSE_EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
+			PARSE_NEXT_TOKEN(tok)
 
-#define FERRY_ARRAY_BACK                                                                           \
-	if (array) {                                                                               \
-		/* x(y) = z (array write) */                                                       \
-		emit_algo(ALGO_ARRAY_WRITE, variables[left_index].location, temp_x_index, temp_x); \
-	}
+			int count = 0;
+			int* origins = NULL;
+			char** args = parse_list(&tok, &count, &origins);
+			PARSE_SYNTAX_ASSERT(!args, "malformed argument list.")
 
-	NEXT_TOKEN(tok)
+			if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
+				push_error(tok->origin, 1, 1, "expected \")\".");
+			}
+			PARSE_NEXT_TOKEN(tok)
+			Token* body = tok;
 
-	int right_index = get_variable_index(tok->value);
+			add_macro(name, args, count, body, origin, origins);
+			summaries = bfm_realloc(summaries, 2 * num_macros * sizeof(Summary));
+			summaries[2 * num_macros - 2] = summaries[2 * num_macros - 1] = (Summary){ 0 };
 
-	if (tok->type == TOK_IDENTIFIER && right_index != -1) {
-		if (variables[right_index].type == VAR_ARRAY) {
-			EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
-			NEXT_TOKEN(tok)
+			int depth = 1;
+			while (tok) {
+				if (tok->type == TOK_KYWRD) {
+					if (tok->data == KYWRD_IF || tok->data == KYWRD_WHILE) {
+						depth++;
+					} else if (tok->data == KYWRD_END) {
+						depth--;
+					}
+				} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_MACRO) {
+					depth++;
+				}
 
-			int subscript_index = get_variable_index(tok->value);
-			if (tok->type == TOK_IDENTIFIER && subscript_index != -1) {
-				emit_algo(ALGO_EQU, temp_y_index, variables[subscript_index].location, -1);
-			} else {
-				int num = expression(&tok);
-				set_cell_to_constant(temp_y_index, num);
+				if (!depth)
+					break;
+
+				tok = tok->next;
 			}
 
-			EXPECT_TOKEN(tok, TOK_OPERATOR, "]")
+			if (depth) {
+				push_error(origin, 0, 1, "no terminating end statement to macro definition.");
+				tok = body;
+				*token = tok;
+				return -1;
+			}
+		} else if (tok->type == TOK_IDENTIFIER && (binding = find_binding(tok->value, ctx)) != -1) {
+			int d = bindings[binding].declaration;
+			if (d >= 0 && declarations[d].first_read < 0)
+				declarations[d].first_read = !sets_variable(tok, d, ctx, stack_ptr - stack_base);
+			note_use(d, clock, weight);
+		} else if (tok->type == TOK_IDENTIFIER && (callee = get_macro_index(tok->value)) != -1) {
+			/* the parser reports recursion */
+			if (summary_of(callee, 0)->walking || summary_of(callee, 1)->walking)
+				continue;
+
+			Summary* expanded = summary_of(callee, looped || loop_depth);
+			if (!expanded->walked) {
+				int caller_first_use = first_use, caller_last_use = last_use;
+				Token* body = macros[callee].body;
+
+				if (summarize(&body, callee, ctx + 1, expanded == summary_of(callee, 1)) < 0) {
+					*token = body;
+					return -1;
+				}
+				first_use = caller_first_use, last_use = caller_last_use;
+			}
 
-			emit_algo(ALGO_ARRAY_READ, temp_y, variables[right_index].location, temp_y_index); /* x = y(z) */
-			right = temp_y;
-		} else {
-			if (left_index == right_index) {
-				emit_algo(ALGO_EQU, temp_y, variables[right_index].location, -1);
-				right = temp_y;
+			expand_summary(expanded, tok, ctx, clock, weight, &site_declarations, &num_sites);
+		} else if (tok->type == TOK_KYWRD && (tok->data == KYWRD_WHILE || tok->data == KYWRD_IF)) {
+			if (tok->data == KYWRD_WHILE) {
+				loops = bfm_realloc(loops, (num_loops + 1) * 2 * sizeof(int));
+				loops[2 * num_loops] = clock;
+				loops[2 * num_loops + 1] = -1;
+				push_stack(num_loops++);
+				loop_depth++;
 			} else {
-				right = variables[right_index].location;
+				push_stack(-1);
 			}
-		}
-	} else {
-		int a = expression(&tok);
-		EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+			push_stack(STACK_WHILE);
+			
+			scope_ptr++;
+		} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_END) {
+			/* the parser reports an end with nothing to end */
+			if (stack_ptr == stack_base && macro_idx < 0)
+				continue;
 
-		if (operation == MOP_SUB) {
-			set_cell_to_constant(temp_y, a);
-			move_pointer_to(temp_y), emit("["), move_pointer_to(left), emit("-"), move_pointer_to(temp_y), emit("-]");
-			*token = tok;
-			FERRY_ARRAY_BACK
-			return;
-		} else if (operation == MOP_ADD) {
-			set_cell_to_constant(temp_y, a);
-			move_pointer_to(temp_y), emit("["), move_pointer_to(left), emit("+"), move_pointer_to(temp_y), emit("-]");
-			*token = tok;
-			FERRY_ARRAY_BACK
-			return;
-		} else if (operation == MOP_EQU) {
-			set_cell_to_constant(left, a);
+			while (num_bindings && bindings[num_bindings - 1].scope >= scope_ptr) {
+				num_bindings--;
+				remove_symbol(&binding_table, num_bindings, bindings[num_bindings].name);
+			}
+			scope_ptr--;
 
-			*token = tok;
-			FERRY_ARRAY_BACK
-			return;
-		} else {
-			set_cell_to_constant(temp_y, a);
+			/* the end of the macro's body */
+			if (stack_ptr == stack_base)
+				break;
 
-			right = temp_y;
+			stack_ptr--;
+			if (stack[--stack_ptr] >= 0) {
+				loops[2 * stack[stack_ptr] + 1] = clock;
+				loop_depth--;
+			}
 		}
 	}
 
-	emit_algo(algo, left, right, -1);
-	FERRY_ARRAY_BACK
+	/* the parser reports a loop with no end */
+	for (int l = first_loop; l < num_loops; l++)
+		if (loops[2 * l + 1] < 0)
+			loops[2 * l + 1] = clock;
+
+	int* widths;
+	summary->num_slots = assign_slots(first_declaration, first_loop, &widths);
+	summary->num_sites = num_sites;
+	summary->widths = arena_alloc(&compile_arena, (summary->num_slots + 1) * sizeof(int));
+	if (widths)
+		memcpy(summary->widths, widths, summary->num_slots * sizeof(int));
+	free(widths);
+
+	int cells = 0;
+	if (macro_idx < 0) {
+		program_locations = bfm_malloc((summary->num_slots + 1) * sizeof(int));
+		cells = place_cells(first_declaration, first_adjacency, summary->num_slots, summary->widths, program_locations);
+	}
 
-	*token = tok;
-}
+	finish_summary(summary, num_args, first_declaration, first_adjacency, first_loop, site_declarations);
+	summary->walking = 0;
+	summary->walked = 1;
 
-enum {
-	STACK_WHILE,
-	STACK_IF,
-	STACK_MACRO
-};
+	num_declarations = first_declaration;
+	num_adjacencies = first_adjacency;
+	num_loops = first_loop;
+	free(site_declarations);
 
-int stack[4096], stack_ptr = 0;
+	return cells;
+}
 
-char** parse_list(Token** token, int* count, int** origins)
+/* returns how many cells the program's variables take */
+int estimate_variables(Token** token)
 {
-	Token* tok = *token;
+	/* syntax errors found by the walk are fatal */
+	int cells = summarize(token, -1, 0, 0);
+	if (cells < 0)
+		check_errors();
 
-	*count = 0;
-	char** args = bfm_malloc(sizeof(char*) * 2);
-	while (tok->type == TOK_IDENTIFIER && tok->next != NULL && tok->next->type == TOK_OPERATOR) {
-		args = bfm_realloc(args, sizeof(char*) * (*count + 1));
-		args[*count] = tok->value;
-		if (origins) {
-			*origins = bfm_realloc(*origins, sizeof(int) * (*count + 1));
-			(*origins)[*count] = tok->origin;
-		}
+	num_macros = 0;
+	num_variables = 0;
+	num_definitions = 0;
+	clear_symbols(&macro_table);
+	clear_symbols(&variable_table);
+	clear_symbols(&definition_table);
+	stack_ptr = 0;
+	tok_sp = 0;
 
-		(*count)++;
-		
-		if (!tok->next) {
-			push_error(tok->origin, 1, 1, "expected a valid token to follow.");
-			*token = tok;
-			return NULL;
-		}
-		tok = tok->next;
+	check_errors();
 
-		if (tok->data == MOP_RBRACE) {
-			break;
-		} else if (tok->data != MOP_COMMA) {
-			push_error(tok->origin, 1, 1, "expected a \",\".");
-			*token = tok;
-			break;
-		} else {
-			if (!tok->next) {
-				push_error(tok->origin, 1, 1, "expected a valid token to follow.");
-				*token = tok;
-				return NULL;
-			}
-			tok = tok->next;
-		}
-	}
+	return cells;
+}
 
-	*token = tok;
-	return args;
+double elapsed_ms(struct timespec* start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - start->tv_sec) * 1000.0 + (now.tv_nsec - start->tv_nsec) / 1000000.0;
 }
 
-Token* tok_stack[4096];
-int tok_sp = 0;
+long count_bytes(Instruction* instr, int len)
+{
+	long bytes = 0;
+	for (int i = 0; i < len; i++)
+		bytes += instr[i].count;
 
-void parse_keyword(Token** token)
+	return bytes;
+}
+
+typedef struct {
+	long bytes;
+	int index;
+} SizeEntry;
+
+int compare_size_entries(const void* a, const void* b)
 {
-	Token* tok = *token;
+	const SizeEntry* x = a, *y = b;
+	if (x->bytes != y->bytes)
+		return x->bytes < y->bytes ? 1 : -1;
+	return x->index - y->index;
+}
 
-	switch (tok->data) {
-		case KYWRD_VAR:
-			NEXT_TOKEN(tok)
+/* prints how much of the output each source line and each macro is
+ * responsible for, biggest first. */
+void print_size_report(Instruction* instr, int len)
+{
+	long total = count_bytes(instr, len);
+	int raw_len = strlen(raw);
+	int num_lines = get_line_num(raw_len) + 1;
+	int* line_of = bfm_malloc((raw_len + 1) * sizeof(int));
+
+	for (int i = 0, line = 0; i <= raw_len; i++) {
+		line_of[i] = line;
+		if (raw[i] == '\n') line++;
+	}
 
-			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
-			SYNTAX_ASSERT(get_keyword(tok->value) != -1, "variable names must not be keywords.")
+	SizeEntry* lines = bfm_malloc(num_lines * sizeof(SizeEntry));
+	int* line_origins = bfm_malloc(num_lines * sizeof(int));
+	SizeEntry* macro_sizes = bfm_malloc((num_macros + 1) * sizeof(SizeEntry));
+	int* macro_expansions = bfm_malloc((num_macros + 1) * sizeof(int));
 
-			add_variable(tok->value, -1, VAR_CELL, used_variable_cells++, context, tok->origin, scope);
-			break;
-		case KYWRD_WHILE: {
-			NEXT_TOKEN(tok)
+	for (int i = 0; i < num_lines; i++)
+		lines[i].bytes = 0, lines[i].index = i, line_origins[i] = -1;
 
-			int var_index = get_variable_index(tok->value);
-			
-			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
-			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for while statements must not be arrays.")
+	for (int i = 0; i < num_macros; i++)
+		macro_sizes[i].bytes = 0, macro_sizes[i].index = i, macro_expansions[i] = 0;
 
-			int variable_location = variables[var_index].location;
-			move_pointer_to(variable_location);
-			emit("[");
+	for (int i = 0; i < num_expansions; i++)
+		macro_expansions[expansions[i].macro]++;
 
-			stack[stack_ptr++] = variable_location;
-			stack[stack_ptr++] = STACK_WHILE;
+	for (int i = 0; i < len; i++) {
+		if (instr[i].origin >= 0) {
+			int line = line_of[instr[i].origin];
+			lines[line].bytes += instr[i].count;
+			if (line_origins[line] == -1)
+				line_origins[line] = instr[i].origin;
+		}
 
-			scope++;
-			
-		} break;
-		case KYWRD_END: {
-			SYNTAX_ASSERT(stack_ptr < 1, "unmatched end statement.")
+		/* a macro is charged for everything emitted by the macros it calls */
+		for (int e = instr[i].expansion; e != -1; e = expansions[e].parent)
+			macro_sizes[expansions[e].macro].bytes += instr[i].count;
+	}
 
-			kill_variables_of_scope(scope--);
-			switch (stack[--stack_ptr]) {
-				case STACK_WHILE:
-					move_pointer_to(stack[--stack_ptr]);
-					emit("]");
-					break;
-				case STACK_IF:
-					move_pointer_to(stack[--stack_ptr]);
-					emit("[-]]");
-					break;
-				case STACK_MACRO:
-					tok = tok_stack[--tok_sp];
-					stack_ptr--;
-					kill_variables_of_context(context--);
-					break;
-			}
-		} break;
-		case KYWRD_GOTO: {
-			NEXT_TOKEN(tok)
+	qsort(lines, num_lines, sizeof(SizeEntry), compare_size_entries);
+	qsort(macro_sizes, num_macros, sizeof(SizeEntry), compare_size_entries);
 
-			int var_index = get_variable_index(tok->value);
+	fprintf(stderr, "size report: %ld byte(s) of brainfuck.\n\nbytes per line:\n", total);
+	for (int i = 0; i < num_lines && lines[i].bytes; i++) {
+		int origin = line_origins[lines[i].index];
+		fprintf(stderr, "%s:%d:%d: %ld byte(s), %.1f%% of the output.\n", input_path,
+		        lines[i].index + 1, get_column_num(origin) + 1,
+		        lines[i].bytes, 100.0 * lines[i].bytes / total);
+		print_location(stderr, origin);
+	}
 
-			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
+	fprintf(stderr, "\nbytes per macro (including the macros it calls):\n");
+	for (int i = 0; i < num_macros && macro_sizes[i].bytes; i++) {
+		Macro* macro = &macros[macro_sizes[i].index];
+		fprintf(stderr, "%s:%d:%d: %s: %ld byte(s) over %d expansion(s), %.1f%% of the output.\n", input_path,
+		        get_line_num(macro->origin) + 1, get_column_num(macro->origin) + 1, macro->name,
+		        macro_sizes[i].bytes, macro_expansions[macro_sizes[i].index],
+		        100.0 * macro_sizes[i].bytes / total);
+		print_location(stderr, macro->origin);
+	}
 
-			int variable_location = variables[var_index].location;
-			move_pointer_to(variable_location);
-		}  break;
-		case KYWRD_IF: {
-			NEXT_TOKEN(tok)
+	free(line_of);
+	free(lines);
+	free(line_origins);
+	free(macro_sizes);
+	free(macro_expansions);
+}
 
-			int var_index = get_variable_index(tok->value);
-			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
-			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for if statements must not be arrays.")
+/* --check-algorithms runs every algorithm over all of its inputs with the
+ * interpreter. it checks the results, that nothing but the result changes
+ * and that the temp cells are left clear, and counts the steps. */
+#define CHECK_TAPE_SIZE 512
+#define CHECK_X 0
+#define CHECK_Y 1
+#define CHECK_TEMPS 2
+#define CHECK_ARRAY (CHECK_TEMPS + num_temp_cells)
+#define CHECK_MAX_STEPS 100000000
+
+char algorithm_names[NUM_ALGORITHMS][16] = {
+	"x / y", "x * y",
+	"x + y", "x - y",
+	"x = y", "x % y",
+	"x > y", "!x",
+	"x == y", "x(y) = z",
+	"x = y(z)", "printv",
+	"x || y", "decimal input",
+	"x && y", "x < y"
+};
 
-			int variable_location = variables[var_index].location;
-			
-			emit_algo(ALGO_EQU, temp_x, variable_location, -1);
-			move_pointer_to(temp_x);
-			emit("[");
+/* sets up the tape for one input of an algorithm and what it should look
+ * like afterwards. returns 0 if the algorithm isn't defined for the input. */
+int check_case(int algo, unsigned x, unsigned y, unsigned* tape, unsigned* expected, char* in, char* out)
+{
+	memset(tape, 0, CHECK_TAPE_SIZE * sizeof(unsigned));
+	in[0] = out[0] = '\0';
 
-			stack[stack_ptr++] = temp_x;
-			stack[stack_ptr++] = STACK_IF;
+	if (algo == ALGO_ARRAY_WRITE || algo == ALGO_ARRAY_READ) {
+		if (x >= GROUP_SIZE)
+			return 0;
 
-			scope++;
-		} break;
-		case KYWRD_NOT: {
-			NEXT_TOKEN(tok)
+		/* a walking array of GROUP_SIZE elements, x is the index and y the value */
+		for (int i = 0; i < GROUP_SIZE; i++)
+			tape[CHECK_ARRAY + 4 + i] = (i * 7 + 3) & cell_mask;
 
-			int var_index = get_variable_index(tok->value);
-			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
-			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for not statements must not be arrays.")
+		tape[CHECK_X] = x;
+		tape[CHECK_Y] = algo == ALGO_ARRAY_WRITE ? y : 0;
+		memcpy(expected, tape, CHECK_TAPE_SIZE * sizeof(unsigned));
 
-			int variable_location = variables[var_index].location;
-			emit_algo(ALGO_NOT, variable_location, -1, -1);
+		if (algo == ALGO_ARRAY_WRITE)
+			expected[CHECK_ARRAY + 4 + x] = y;
+		else
+			expected[CHECK_Y] = (x * 7 + 3) & cell_mask;
+
+		return 1;
+	}
+
+	tape[CHECK_X] = algo == ALGO_DECIM ? 0 : x;
+	tape[CHECK_Y] = y;
+	memcpy(expected, tape, CHECK_TAPE_SIZE * sizeof(unsigned));
+
+	unsigned result = 0;
+	int defined = 1;
+	switch (algo) {
+		case ALGO_DIV:  result = y ? x / y : 0, defined = y; break;
+		case ALGO_MUL:  result = x * y; break;
+		case ALGO_ADD:  result = x + y; break;
+		case ALGO_SUB:  result = x - y; break;
+		case ALGO_EQU:  result = y; break;
+		case ALGO_MOD:  result = y ? x % y : 0, defined = y; break;
+		case ALGO_GRT:  result = x > y; break;
+		case ALGO_NOT:  result = !x; break;
+		case ALGO_CEQU: result = x == y; break;
+		case ALGO_OR:   result = x || y; break;
+		case ALGO_AND:  result = x && y; break;
+		case ALGO_LESS: result = x < y; break;
+		case ALGO_DECIM: {
+			sprintf(in, "%u\n", x);
+			result = x;
 		} break;
-		case KYWRD_PRINT: {
-				NEXT_TOKEN(tok)
+		default: { /* printv */
+			sprintf(out, "%u", x);
+			result = x;
+		} break;
+	}
 
-				int var_index = get_variable_index(tok->value);
-				if (tok->type == TOK_STRING) {
-					emit_print_string(tok);
-				} else if (tok->type == TOK_IDENTIFIER && var_index != -1) {
-					int left = 0;
-					if (variables[var_index].type == VAR_ARRAY) {
-						EXPECT_TOKEN(tok, TOK_OPERATOR, "[")
-						NEXT_TOKEN(tok)
+	expected[CHECK_X] = result & cell_mask;
+	return defined;
+}
 
-						int subscript_index = get_variable_index(tok->value);
-						if (tok->type == TOK_IDENTIFIER && subscript_index != -1) {
-							emit_algo(ALGO_EQU, temp_y_index, variables[subscript_index].location, -1);
-						} else {
-							int num = expression(&tok);
-							move_pointer_to(temp_y_index);
-							emit("[-]");
-							add(num);
-						}
+typedef struct {
+	int inputs, failures, dirty;
+	int slow; /* values near the top of a wide cell that took more than max_steps */
+	long min_steps, max_steps;
+	double mean_steps;
+} CheckResult;
+
+/* the inputs where algorithms tend to go wrong, used along with a few
+ * others when only a sample of the inputs is checked */
+unsigned char check_edges[] = { 0, 1, 2, 3, 7, 15, 16, 17, 127, 128, 129, 200, 253, 254, 255 };
+#define NUM_CHECK_EDGES ((int)sizeof(check_edges))
+#define NUM_CHECK_SAMPLES 64
+
+/* wider cells are also checked at the values around the middle and the top
+ * of the cell, against each other and against each of the edges above,
+ * since that's where the wide algorithms could still wrap */
+#define NUM_WIDE_EDGES 5
+
+void wide_check_case(int i, int unary, unsigned* x, unsigned* y)
+{
+	unsigned wide_edges[NUM_WIDE_EDGES] = { 256, cell_mask / 2, cell_mask / 2 + 1, cell_mask - 1, cell_mask };
 
-						EXPECT_TOKEN(tok, TOK_OPERATOR, "]")
+	if (unary) {
+		*x = wide_edges[i], *y = 0;
+	} else if (i < NUM_WIDE_EDGES * NUM_WIDE_EDGES) {
+		*x = wide_edges[i / NUM_WIDE_EDGES], *y = wide_edges[i % NUM_WIDE_EDGES];
+	} else {
+		i -= NUM_WIDE_EDGES * NUM_WIDE_EDGES;
+		unsigned wide = wide_edges[i / (2 * NUM_CHECK_EDGES)], edge = check_edges[i % NUM_CHECK_EDGES];
+		int wide_is_x = i % (2 * NUM_CHECK_EDGES) < NUM_CHECK_EDGES;
+		*x = wide_is_x ? wide : edge, *y = wide_is_x ? edge : wide;
+	}
+}
 
-						emit_algo(ALGO_ARRAY_READ, temp_y, variables[var_index].location, temp_y_index); /* x = y(z) */
-						left = temp_y;
-					} else {
-						left = variables[var_index].location;
-					}
+/* runs an algorithm over all of its inputs, or only a sample of them, with
+ * the steps limited to max_steps. the first failure is printed if report
+ * is set. */
+void check_algorithm(int algo, const char* algorithm, int sampled, int report, CheckResult* result)
+{
+	unsigned tape[CHECK_TAPE_SIZE], expected[CHECK_TAPE_SIZE];
+	char in[16], out[16], printed[CHECK_TAPE_SIZE];
 
-					emit_algo(ALGO_PRINTV, left, -1, -1);
-				} else {
-					int a = expression(&tok);
-					EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
-					
-					move_pointer_to(temp_cells);
-					emit("[-]"), add(a), emit(".");
-				}
-			} break;
-		case KYWRD_ARRAY: {
-			NEXT_TOKEN(tok)
-			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
-			char* name = tok->value;
-			NEXT_TOKEN(tok)
+	temp_cells = CHECK_TEMPS;
+	reset_emit();
+	cell_pointer = 0;
 
-			int a = expression(&tok);
-			EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
-			add_variable(name, a, VAR_ARRAY, arrays + used_array_cells, context, tok->origin, scope);
-		} break;
-		case KYWRD_BF: {
-			NEXT_TOKEN(tok)
-			SYNTAX_ASSERT(tok->type != TOK_STRING, "expected a string literal.")
-			emit(tok->value);
-		} break;
-		case KYWRD_DEFINE: {
-			NEXT_TOKEN(tok)
-			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
+	switch (algo) {
+		case ALGO_ARRAY_WRITE: emit_template(algorithm, CHECK_ARRAY, CHECK_X, CHECK_Y); break;
+		case ALGO_ARRAY_READ:  emit_template(algorithm, CHECK_Y, CHECK_ARRAY, CHECK_X); break;
+		default:               emit_template(algorithm, CHECK_X, CHECK_Y, -1); break;
+	}
 
-			char* name = tok->value;
-			NEXT_TOKEN(tok)
-			SYNTAX_ASSERT(tok->type != TOK_NUMBER, "expected a number.")
+	lower_code(code, code_len);
+
+	/* the unary ones only read x */
+	int unary = algo == ALGO_NOT || algo == ALGO_PRINTV || algo == ALGO_DECIM;
+	int num_wide = cell_bits == 8 ? 0 : NUM_WIDE_EDGES;
+	int num_cases = sampled ? (unary ? NUM_CHECK_EDGES : NUM_CHECK_EDGES * NUM_CHECK_EDGES) + NUM_CHECK_SAMPLES
+	                        : (unary ? 256 : 256 * 256);
+	int num_narrow = num_cases;
+	num_cases += unary ? num_wide : num_wide * (num_wide + 2 * NUM_CHECK_EDGES);
+	long total_steps = 0;
+	int measured = 0;
+
+	memset(result, 0, sizeof(CheckResult));
+	result->min_steps = -1;
+
+	for (int i = 0; i < num_cases; i++) {
+		int wide = i >= num_narrow;
+		unsigned x, y;
+		if (wide) {
+			wide_check_case(i - num_narrow, unary, &x, &y);
+		} else if (!sampled) {
+			x = unary ? i : i / 256, y = unary ? 0 : i % 256;
+		} else if (i >= num_narrow - NUM_CHECK_SAMPLES) {
+			x = (i * 97 + 13) & 255, y = unary ? 0 : (i * 59 + 31) & 255;
+		} else {
+			x = check_edges[unary ? i : i / NUM_CHECK_EDGES], y = unary ? 0 : check_edges[i % NUM_CHECK_EDGES];
+		}
 
-			double data = expression(&tok);
-			EXPECT_TOKEN(tok, TOK_OPERATOR, ";")
+		if (!check_case(algo, x, y, tape, expected, in, out))
+			continue;
 
-			add_definition(name, (int)data);
-		} break;
-		case KYWRD_INPUT: {
-			NEXT_TOKEN(tok)
+		result->inputs++;
+
+		/* the algorithm runs a second time with junk in the temp cells, since
+		 * the compiler doesn't clear them between algorithms */
+		long steps = 0;
+		int failed = 0, dirty = 0, slow = 0;
+		for (int junk = 0; junk < 2 && !failed; junk++) {
+			if (junk) {
+				check_case(algo, x, y, tape, expected, in, out);
+				for (int j = 0; j < 8; j++)
+					tape[CHECK_TEMPS + j] = 0x5a + 13 * j;
+			}
 
-			int var_index = get_variable_index(tok->value);
+			FILE* input = fmemopen(in, strlen(in) + 1, "r");
+			FILE* output = fmemopen(printed, sizeof(printed), "w");
 
-			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
-			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for input statements must not be arrays.")
-			
-			move_pointer_to(variables[var_index].location);
-			emit(",");
-		} break;
-		case KYWRD_WRITE: {
-			NEXT_TOKEN(tok)
-			SYNTAX_ASSERT(tok->type != TOK_STRING, "expected a string.")
+			steps_executed = 0;
+			int off_tape = run_operations(ops, ops_len, tape, CHECK_TAPE_SIZE, input, output);
+			int too_long = steps_executed > max_steps;
 
-			emit_write_string(tok);
-		} break;
-		case KYWRD_DECIM: {
-			NEXT_TOKEN(tok)
-			SYNTAX_ASSERT(tok->type != TOK_IDENTIFIER, "expected an identifier.")
-			int var_index = get_variable_index(tok->value);
-			SYNTAX_ASSERT(var_index == -1, "invalid identifier.")
-			SYNTAX_ASSERT(variables[var_index].type != VAR_CELL, "arguments for decimal statements must not be arrays.")
+			fclose(input);
+			fclose(output);
 
-			emit_algo(ALGO_DECIM, variables[var_index].location, -1, -1);
-		} break;
-		case KYWRD_MACRO: {
-			NEXT_TOKEN(tok)
-			
-			if (tok->type != TOK_IDENTIFIER)
-				push_error(tok->origin, 1, 1, "expected an identifier.");
+			/* an algorithm counting down a value near the top of a wide cell
+			 * can take far longer than max_steps, which isn't wrong */
+			if (too_long && wide) {
+				slow = 1;
+				break;
+			}
 
-			char* name = tok->value;
-			int origin = tok->origin;
-			EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
-			NEXT_TOKEN(tok)
+			/* only whether the logical operators give zero or not matters */
+			if (algo == ALGO_OR || algo == ALGO_AND)
+				tape[CHECK_X] = !!tape[CHECK_X];
 
-			int count = 0;
-			int* origins = bfm_malloc(2);
-			char** args = parse_list(&tok, &count, &origins);
-			SYNTAX_ASSERT(!args, "malformed argument list.")
+			/* a wrong cell outside of the temp cells is worse than a dirty temp cell */
+			int cell = -1, temp = -1;
+			for (int j = 0; j < CHECK_TAPE_SIZE; j++) {
+				if (tape[j] == expected[j])
+					continue;
 
-			if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
-				push_error(tok->origin, 1, 1, "expected \")\".");
+				if (j >= CHECK_TEMPS && j < CHECK_ARRAY)
+					temp = temp == -1 ? j : temp;
+				else
+					cell = cell == -1 ? j : cell;
 			}
-			NEXT_TOKEN(tok)
-			Token* body = tok;
 
-			add_macro(name, args, count, body, origin, origins);
+			failed = off_tape || too_long || cell != -1 || (algo == ALGO_PRINTV && strcmp(printed, out));
+			if (failed && !result->failures && report) {
+				if (off_tape)
+					printf("%s: x=%u y=%u moves the pointer off of the tape.\n", algorithm_names[algo], x, y);
+				else if (too_long)
+					printf("%s: x=%u y=%u doesn't finish.\n", algorithm_names[algo], x, y);
+				else if (cell != -1)
+					printf("%s: x=%u y=%u%s leaves cell %d at %u instead of %u.\n", algorithm_names[algo], x, y,
+					       junk ? " with junk in the temp cells" : "", cell, tape[cell], expected[cell]);
+				else
+					printf("%s: x=%u prints \"%s\".\n", algorithm_names[algo], x, printed);
+			}
 
-			int depth = 1;
-			while (tok) {
-				if (tok->type == TOK_KYWRD) {
-					if (tok->data == KYWRD_IF || tok->data == KYWRD_WHILE) {
-						depth++;
-					} else if (tok->data == KYWRD_END) {
-						depth--;
-					}
-				} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_MACRO) {
-					depth++;
-				}
+			/* a sample is only a rough guide, so don't wait for code that doesn't end */
+			if (too_long && sampled) {
+				result->failures += num_cases - i;
+				result->inputs += num_cases - i - 1;
+				i = num_cases;
+			}
+
+			if (!junk) {
+				steps = steps_executed;
+				dirty = temp != -1;
+				if (dirty && !result->dirty && report)
+					printf("%s: x=%u y=%u leaves temp cell %d at %u.\n", algorithm_names[algo], x, y, temp - CHECK_TEMPS, tape[temp]);
+			}
+		}
+
+		if (i == num_cases)
+			break;
+
+		if (slow) {
+			result->inputs--, result->slow++;
+			continue;
+		}
 
-				if (!depth)
-					break;
+		if (failed) {
+			result->failures++;
+			continue;
+		}
 
-				tok = tok->next;
-			}
+		result->dirty += dirty;
 
-			if (depth) {
-				push_error(origin, 0, 1, "no terminating end statement to macro definition.");
-				tok = body;
-				*token = tok;
-				return;
-			}
+		/* the steps are only counted over the first 256 values, so that they
+		 * can be compared between widths */
+		if (wide)
+			continue;
 
-			// printf("found a macro called %s with %d arguments.\n", name, count);
-		} break;
+		steps_executed = steps;
+		measured++;
+
+		if (result->min_steps < 0 || steps_executed < result->min_steps)
+			result->min_steps = steps_executed;
+		if (steps_executed > result->max_steps)
+			result->max_steps = steps_executed;
+		total_steps += steps_executed;
 	}
 
-	*token = tok;
+	result->mean_steps = measured ? (double)total_steps / measured : 0.0;
+	result->min_steps = result->min_steps < 0 ? 0 : result->min_steps;
+
+	free(ops);
+	ops = NULL, ops_allocated = 0;
 }
 
-/* TODO: change the error system so the we can report both the location of a problematic
- * macro and the expansion that caused the issue. */
-void parse_macro(Token** token)
+int check_algorithms()
 {
-	Token* tok = *token;
-
-	int macro_idx = get_macro_index(tok->value);
+	int failed = 0;
+	max_steps = CHECK_MAX_STEPS;
 
-	for (int i = stack_ptr - 1; i >= 1; i -= 2) {
-		if (stack[i] == STACK_MACRO && stack[i - 1] == macro_idx) {
-			push_error(macros[macro_idx].origin, 0, 1, "recursive macro definition.");
-			int num_args = 0;
-			EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
-			NEXT_TOKEN(tok)
-			char** args = parse_list(&tok, &num_args, NULL);
+	printf("%-14s %8s %8s %8s %8s %10s %10s %12s\n", "algorithm", "inputs", "failures", "dirty", "too slow",
+	       "min steps", "max steps", "mean steps");
 
-			if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
-				push_error(tok->origin, 0, 1, "expected \")\".");
-			}
+	for (int algo = 0; algo < NUM_ALGORITHMS; algo++) {
+		CheckResult result;
+		check_algorithm(algo, algorithms[algo], 0, 1, &result);
 
-			free(args);
-			*token = tok->next;
+		printf("%-14s %8d %8d %8d %8d %10ld %10ld %12.1f\n", algorithm_names[algo], result.inputs, result.failures,
+		       result.dirty, result.slow, result.min_steps, result.max_steps, result.mean_steps);
+		fflush(stdout);
 
-			return;
-		}
+		failed += result.failures + result.dirty;
 	}
 
-	EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
-	NEXT_TOKEN(tok)
-	
-	int num_args = 0;
-	char** args = parse_list(&tok, &num_args, NULL);
+	free(code);
+	return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
 
-	if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
-		push_error(tok->origin, 1, 1, "expected \")\".");
-	}
+#ifdef BFM_SUPEROPT
+/* the superoptimizer looks for cheaper templates for the algorithms by
+ * mutating them at random and keeping what still passes the check, and for
+ * cheaper code for the constants table. it's only built by make superopt,
+ * and prints what it finds in the form of the tables in this file. */
+enum {
+	METRIC_MEAN, METRIC_MAX, METRIC_SIZE
+} superopt_metric = METRIC_MEAN;
 
-	SYNTAX_ASSERT(!args, "malformed argument list.")
-	SYNTAX_ASSERT(num_args != macros[macro_idx].num_args, "incorrect number of arguments to macro.")
-	tok_stack[tok_sp++] = tok;
-	stack[stack_ptr++] = macro_idx;
-	stack[stack_ptr++] = STACK_MACRO;
-	scope++;
+char superopt_metrics[3][8] = { "mean", "max", "size" };
 
-	int failed = 0;
-	for (int i = 0; i < num_args; i++) {
-		int arg_idx = get_variable_index(args[i]);
-		if (arg_idx == -1) {
-			push_error(tok->origin, 0, 1, "unrecognized variable.");
-			failed = 1;
-			continue;
-		}
-		add_variable(macros[macro_idx].args[i], -1, variables[arg_idx].type, variables[arg_idx].location, context + 1, macros[macro_idx].origins[i], -1);
+/* what makes one algorithm cheaper than another */
+double superopt_measure(CheckResult* result)
+{
+	switch (superopt_metric) {
+		case METRIC_MEAN: return result->mean_steps;
+		case METRIC_MAX:  return result->max_steps;
+		case METRIC_SIZE: break;
 	}
 
-	if (failed) {
-		*token = tok;
-		return;
+	return count_bytes(code, code_len);
+}
+
+/* the cost the search minimizes: every failing input costs as much as the
+ * original algorithm, so wrong candidates can be walked through but are
+ * never kept */
+double superopt_cost(int algo, const char* algorithm, int sampled, double scale, CheckResult* result)
+{
+	check_algorithm(algo, algorithm, sampled, 0, result);
+	return superopt_measure(result) / scale + result->failures + result->dirty;
+}
+
+int superopt_balanced(const char* algorithm)
+{
+	int depth = 0;
+	for (int i = 0; algorithm[i]; i++) {
+		if (algorithm[i] == '[') depth++;
+		if (algorithm[i] == ']' && --depth < 0) return 0;
 	}
 
-	context++;
-	tok = macros[macro_idx].body;
+	return !depth;
+}
 
-	*token = tok;
+/* changes one thing about the template: drops, adds, replaces, swaps or
+ * repeats one of its characters. alphabet holds what can be added. */
+void superopt_mutate(char* algorithm, const char* alphabet)
+{
+	int len = strlen(algorithm), at = len ? rand() % len : 0;
+	char c = alphabet[rand() % strlen(alphabet)];
+
+	switch (rand() % 5) {
+		case 0:
+			memmove(&algorithm[at], &algorithm[at + 1], len - at);
+			break;
+		case 1:
+			memmove(&algorithm[at + 1], &algorithm[at], len - at + 1);
+			algorithm[at] = c;
+			break;
+		case 2:
+			algorithm[at] = c;
+			break;
+		case 3:
+			if (at + 1 < len) {
+				char t = algorithm[at];
+				algorithm[at] = algorithm[at + 1];
+				algorithm[at + 1] = t;
+			}
+			break;
+		case 4:
+			memmove(&algorithm[at + 1], &algorithm[at], len - at + 1);
+			break;
+	}
 }
 
-void parse(Token* tok)
+/* drops what can't make a difference: moves to a cell right before moving
+ * to another one, and + and - next to each other */
+void superopt_normalize(char* algorithm)
 {
-	while (tok) {
-		if (tok->type == TOK_KYWRD) {
-			parse_keyword(&tok);
-			tok = tok->next;
-		} else if (tok->type == TOK_IDENTIFIER && get_variable_index(tok->value) != -1) {
-			parse_operation(&tok);
-			tok = tok->next;
-		} else if (tok->type == TOK_IDENTIFIER && get_macro_index(tok->value) != -1) {
-			parse_macro(&tok);
-		} else {
-			push_error(tok->origin, 1, 1, "invalid statement.", tok->value);
-			tok = tok->next;
+	int changed = 1;
+	while (changed) {
+		changed = 0;
+
+		int j = 0;
+		for (int i = 0; algorithm[i]; i++) {
+			char c = algorithm[i], next = algorithm[i + 1];
+			if (!IS_BF_COMMAND(c) && next && !IS_BF_COMMAND(next)) {
+				changed = 1;
+			} else if ((c == '+' && next == '-') || (c == '-' && next == '+')) {
+				changed = 1, i++;
+			} else {
+				algorithm[j++] = c;
+			}
 		}
+		algorithm[j] = '\0';
 	}
-	kill_variables_of_scope(scope--);
+}
 
-	check_errors();
+/* tries to drop each character of the best algorithm in turn */
+void superopt_simplify(int algo, char* best, double* best_full, long long full_limit)
+{
+	char candidate[256];
+	CheckResult result;
+
+	for (int i = 0; best[i]; i++) {
+		strcpy(candidate, best);
+		memmove(&candidate[i], &candidate[i + 1], strlen(candidate) - i);
+		superopt_normalize(candidate);
+		if (!superopt_balanced(candidate))
+			continue;
+
+		max_steps = full_limit;
+		check_algorithm(algo, candidate, 1, 0, &result);
+		if (result.failures || result.dirty)
+			continue;
+
+		check_algorithm(algo, candidate, 0, 0, &result);
+		if (result.failures || result.dirty || superopt_measure(&result) > *best_full)
+			continue;
+
+		strcpy(best, candidate);
+		*best_full = superopt_measure(&result);
+		i = -1;
+	}
 }
 
-void delete_list(Token* tok)
+void superopt_algorithm(int algo, long iterations)
 {
-	Token* current = tok;
-	Token* next = NULL, *prev = NULL;
-	while (current) {
-		prev = current;
-		next = current->next;
+	char alphabet[32] = "+-[]", current[512], candidate[512], best[256];
+	CheckResult result;
+
+	/* anything the original refers to can be referred to */
+	for (int i = 0; algorithms[algo][i]; i++) {
+		char c = algorithms[algo][i];
+		if (!IS_BF_COMMAND(c) && !strchr(alphabet, c))
+			strncat(alphabet, &c, 1);
+	}
+
+	strcpy(current, algorithms[algo]);
+	strcpy(best, algorithms[algo]);
+
+	max_steps = CHECK_MAX_STEPS;
+	check_algorithm(algo, best, 0, 1, &result);
+	double original = superopt_measure(&result), best_full = original;
+	long long full_limit = 4 * result.max_steps + 1000;
+	int best_broken = result.failures + result.dirty;
+
+	check_algorithm(algo, best, 1, 0, &result);
+	long long sample_limit = 4 * result.max_steps + 1000;
+	double scale = superopt_measure(&result) > 0 ? superopt_measure(&result) : 1;
 
-		free(current->value);
-		if (current->prev)
-			free(current->prev);
+	max_steps = sample_limit;
+	double current_cost = superopt_cost(algo, current, 1, scale, &result);
+	double best_cost = current_cost;
 
-		current = next;
+	printf("%s: %s %.1f, %d input(s) wrong or dirty.\n", algorithm_names[algo], superopt_metrics[superopt_metric],
+	       original, best_broken);
+
+	for (long i = 0; i < iterations; i++) {
+		strcpy(candidate, current);
+		superopt_mutate(candidate, alphabet);
+		superopt_normalize(candidate);
+		if (!candidate[0] || strlen(candidate) >= sizeof(best) || !superopt_balanced(candidate))
+			continue;
+
+		max_steps = sample_limit;
+		double cost = superopt_cost(algo, candidate, 1, scale, &result);
+
+		/* the temperature falls as the search goes on */
+		double temperature = 0.1 * (1.0 - (double)i / iterations) + 0.001;
+		if (cost > current_cost && (double)rand() / RAND_MAX >= exp((current_cost - cost) / temperature))
+			continue;
+
+		strcpy(current, candidate);
+		current_cost = cost;
+
+		if (result.failures || result.dirty || cost >= best_cost)
+			continue;
+
+		/* it passes the sample, so it's worth checking every input */
+		max_steps = full_limit;
+		check_algorithm(algo, candidate, 0, 0, &result);
+		if (result.failures || result.dirty || (superopt_measure(&result) >= best_full && !best_broken))
+			continue;
+
+		strcpy(best, candidate);
+		best_cost = cost;
+		best_full = superopt_measure(&result);
+		best_broken = 0;
+
+		printf("%s: %s %.1f after %ld iteration(s): %s\n", algorithm_names[algo], superopt_metrics[superopt_metric],
+		       best_full, i + 1, best);
+		fflush(stdout);
 	}
 
-	if (prev)
-		free(prev);
+	if (!best_broken)
+		superopt_simplify(algo, best, &best_full, full_limit);
+
+	printf("\n/* %s: %s %.1f -> %.1f */\n", algorithm_names[algo], superopt_metrics[superopt_metric], original, best_full);
+	printf("\t\"%s\", /* %s */\n", best, algorithm_names[algo]);
 }
 
-int scopes[4096], scope_ptr;
-int estimate_variables(Token** token)
+/* runs code that sets a constant on a clear tape. returns the value the
+ * pointer ends on, or -1 if the code leaves anything else behind. */
+int superopt_run_constant(const char* code, long* steps, int* cells)
 {
-	Token* tok = *token;
-	int top = 0;
+	unsigned char tape[64] = { 0 };
+	int p = 0, stack[64], sp = 0, used = 1;
+	long executed = 0;
 
-	while (tok) {
-		int living_cells = 0;
-		for (int i = 0; i <= scope_ptr; i++) {
-			living_cells += scopes[i];
+	for (int ip = 0; code[ip]; ip++) {
+		executed++;
+
+		switch (code[ip]) {
+			case '+': tape[p]++; break;
+			case '-': tape[p]--; break;
+			case '>': if (++p == 64) return -1; used = p + 1 > used ? p + 1 : used; break;
+			case '<': if (--p < 0) return -1; break;
+			case '[':
+				if (tape[p]) {
+					stack[sp++] = ip;
+				} else {
+					for (int depth = 1; depth; ) {
+						ip++;
+						depth += code[ip] == '[' ? 1 : code[ip] == ']' ? -1 : 0;
+					}
+				}
+				break;
+			case ']': ip = stack[--sp] - 1; break;
 		}
 
-		top = (living_cells > top) ? living_cells : top;
+		if (executed > 1000000)
+			return -1;
+	}
 
-		if (tok->type == TOK_KYWRD && tok->data == KYWRD_VAR) {
-			scopes[scope_ptr]++;
-		} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_MACRO) {
-			PARSE_NEXT_TOKEN(tok)
-			
-			if (tok->type != TOK_IDENTIFIER)
-				push_error(tok->origin, 1, 1, "expected an identifier.");
+	for (int i = 0; i < 64; i++)
+		if (i != p && tape[i])
+			return -1;
 
-			char* name = tok->value;
-			int origin = tok->origin;
-			PARSE_EXPECT_TOKEN(tok, TOK_OPERATOR, "(")
-			PARSE_NEXT_TOKEN(tok)
+	*steps = executed, *cells = used;
+	return tape[p];
+}
 
-			int count = 0;
-			int* origins = bfm_malloc(2);
-			char** args = parse_list(&tok, &count, &origins);
-			PARSE_SYNTAX_ASSERT(!args, "malformed argument list.")
+typedef struct {
+	char code[64];
+	long steps;
+	int cells;
+} SuperoptConstant;
 
-			if (tok->type != TOK_OPERATOR && strcmp(tok->value, ")")) {
-				push_error(tok->origin, 1, 1, "expected \")\".");
-			}
-			PARSE_NEXT_TOKEN(tok)
-			Token* body = tok;
+/* whether code of this length and steps is cheaper than the entry */
+int superopt_cheaper(SuperoptConstant* entry, long len, long steps)
+{
+	long entry_len = strlen(entry->code);
 
-			add_macro(name, args, count, body, origin, origins);
+	if (entry->steps < 0)
+		return 1;
+	if (superopt_metric == METRIC_SIZE)
+		return len < entry_len || (len == entry_len && steps < entry->steps);
 
-			int depth = 1;
-			while (tok) {
-				if (tok->type == TOK_KYWRD) {
-					if (tok->data == KYWRD_IF || tok->data == KYWRD_WHILE) {
-						depth++;
-					} else if (tok->data == KYWRD_END) {
-						depth--;
-					}
-				} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_MACRO) {
-					depth++;
-				}
+	return steps < entry->steps || (steps == entry->steps && len < entry_len);
+}
 
-				if (!depth)
-					break;
+/* keeps code for the value it sets if it's cheaper than what's there */
+void superopt_offer_constant(SuperoptConstant* table, const char* code)
+{
+	long steps;
+	int cells, value = superopt_run_constant(code, &steps, &cells);
+	if (value < 0 || strlen(code) >= sizeof(table->code))
+		return;
 
-				tok = tok->next;
-			}
+	if (superopt_cheaper(&table[value], strlen(code), steps)) {
+		strcpy(table[value].code, code);
+		table[value].steps = steps;
+		table[value].cells = cells;
+	}
+}
 
-			if (depth) {
-				push_error(origin, 0, 1, "no terminating end statement to macro definition.");
-				tok = body;
-				*token = tok;
-				return -1;
-			}
-		} else if (tok->type == TOK_IDENTIFIER && get_macro_index(tok->value) != -1) {
-			int macro_idx = get_macro_index(tok->value);
-			
-			tok_stack[tok_sp++] = tok;
-			tok = macros[macro_idx].body->prev;
+/* the shortest run of + or - that adds amount */
+void superopt_adjust(char* code, int amount)
+{
+	amount = (amount % 256 + 256) % 256;
+	if (amount > 128)
+		memset(code, '-', 256 - amount), code[256 - amount] = '\0';
+	else
+		memset(code, '+', amount), code[amount] = '\0';
+}
 
-			stack[stack_ptr++] = macro_idx;
-			stack[stack_ptr++] = STACK_MACRO;
-			
-			scopes[++scope_ptr] = 0;
-		} else if (tok->type == TOK_KYWRD && (tok->data == KYWRD_WHILE || tok->data == KYWRD_IF)) {
-			stack[stack_ptr++] = 0;
-			stack[stack_ptr++] = STACK_WHILE;
-			
-			scopes[++scope_ptr] = 0;
-		} else if (tok->type == TOK_KYWRD && tok->data == KYWRD_END) {
-			switch (stack[--stack_ptr]) {
-				case STACK_MACRO: {
-					tok = tok_stack[--tok_sp];
-					stack_ptr--;
-				} break;
-				case STACK_WHILE: {
-					stack_ptr--;
-				} break;
-			}
+int superopt_adjust_len(int amount)
+{
+	amount = (amount % 256 + 256) % 256;
+	return amount > 128 ? 256 - amount : amount;
+}
 
-			scope_ptr--;
+/* builds the constants table from the code that's there, adding to a cell
+ * directly, and loops that add to a second cell, whichever is cheapest */
+void superopt_constants()
+{
+	SuperoptConstant table[256];
+	for (int i = 0; i < 256; i++)
+		table[i].steps = -1, table[i].code[0] = '\0';
+
+	for (int i = 0; i < 256; i++) {
+		char direct[256];
+		superopt_adjust(direct, i);
+		superopt_offer_constant(table, direct);
+		superopt_offer_constant(table, bf_constants[i].code);
+	}
+
+	/* counter[>step<count]>adjust, where the loop runs until the counter
+	 * wraps to zero. the cost is worked out without running the loop. */
+	for (int counter = 1; counter < 256; counter++) {
+		for (int count = -8; count <= 8; count++) {
+			int left = counter, iterations = 0;
+			while (left && iterations < 256 && count)
+				left = (left + count + 256) % 256, iterations++;
+			if (left)
+				continue;
+
+			for (int step = -24; step <= 24; step++) {
+				if (!step)
+					continue;
+
+				long len = superopt_adjust_len(counter) + superopt_adjust_len(step) + abs(count) + 5;
+				long steps = superopt_adjust_len(counter) + (iterations + 1) + 1
+				             + (long)iterations * (superopt_adjust_len(step) + abs(count) + 3);
+				int looped = ((iterations * step) % 256 + 256) % 256;
+
+				for (int adjust = -24; adjust <= 24; adjust++) {
+					int value = (looped + adjust + 256) % 256, extra = superopt_adjust_len(adjust);
+					if (len + extra >= (long)sizeof(table->code) || !superopt_cheaper(&table[value], len + extra, steps + extra))
+						continue;
+
+					char init[256], body[256], dec[256], tail[256], code[4 * 256 + 8];
+					superopt_adjust(init, counter);
+					superopt_adjust(body, step);
+					superopt_adjust(dec, count);
+					superopt_adjust(tail, adjust);
+					snprintf(code, sizeof(code), "%s[>%s<%s]>%s", init, body, dec, tail);
+					superopt_offer_constant(table, code);
+				}
+			}
 		}
+	}
 
-		tok = tok->next;
+	printf("/* constants for the %s metric */\n", superopt_metric == METRIC_SIZE ? "size" : "steps");
+	for (int i = 0; i < 256; i++) {
+		char quoted[80];
+		int len = snprintf(quoted, sizeof(quoted), "\"%s\",", table[i].code);
+		printf("/* %-3d */\t{ %s%*s%d }%s\n", i, quoted, len < 24 ? 24 - len : 1, "", table[i].cells, i < 255 ? "," : "");
 	}
+}
 
-	num_macros = 0;
-	num_variables = 0;
-	num_definitions = 0;
-	stack_ptr = 0;
-	tok_sp = 0;
+int superopt_main(int argc, char** argv)
+{
+	int algo = -1, constants = 0;
+	long iterations = 10000;
+	unsigned seed = 1;
 
-	// printf("top: %d\n", top);
-	check_errors();
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--superopt") && i + 1 < argc) {
+			char* name = argv[++i];
+			for (int j = 0; j < NUM_ALGORITHMS; j++)
+				if (!strcmp(name, algorithm_names[j]))
+					algo = j;
+			if (algo == -1 && IS_DIGIT(name[0]))
+				algo = atoi(name);
+		} else if (!strcmp(argv[i], "--superopt-constants")) {
+			constants = 1;
+		} else if (!strcmp(argv[i], "--metric") && i + 1 < argc) {
+			i++;
+			for (int j = 0; j < 3; j++)
+				if (!strcmp(argv[i], superopt_metrics[j]))
+					superopt_metric = j;
+		} else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+			iterations = strtol(argv[++i], NULL, 0);
+		} else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+			seed = strtoul(argv[++i], NULL, 0);
+		}
+	}
 
-	return top;
+	srand(seed);
+
+	if (constants) {
+		superopt_constants();
+	} else if (algo >= 0 && algo < NUM_ALGORITHMS) {
+		superopt_algorithm(algo, iterations);
+	} else {
+		fatal_error(-1, "Usage: bfm-superopt --superopt ALGORITHM|--superopt-constants [--metric mean|max|size] [--iterations N] [--seed N]");
+	}
+
+	free(code);
+	return 0;
 }
+#endif
 
 int main(int argc, char **argv)
 {
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	/* eight bit cells until --cell-bits says otherwise */
+	set_cell_bits(cell_bits);
+
+#ifdef BFM_SUPEROPT
+	return superopt_main(argc, argv);
+#endif
+
 	for (int i = 1; i < argc; i++) {
 		if (!strncmp(argv[i], "-o", 2)) {
 			if (output_path) {
-				fatal_error(-1, "Usage: bfm INPUT_PATH -oOUTPUT_PATH");
+				fatal_error(-1, "Usage: bfm INPUT_PATH [-oOUTPUT_PATH] [-target bf|c] [--run] [--no-jit] [--stats] [--max-steps N] [--size-report] [-Osize|-Ospeed] [--cell-bits 8|16|32] [-v] [--check-algorithms]");
 			}
 
 			output_path = &argv[i][2];
 		} else if (!strcmp(argv[i], "-v")) {
 			verbose = 1;
+		} else if (!strcmp(argv[i], "--run")) {
+			run = 1;
+		} else if (!strcmp(argv[i], "--no-jit")) {
+			use_jit = 0;
+		} else if (!strcmp(argv[i], "--stats")) {
+			print_stats = 1;
+		} else if (!strcmp(argv[i], "--size-report")) {
+			size_report = 1;
+		} else if (!strcmp(argv[i], "--check-algorithms")) {
+			check_algos = 1;
+		} else if (!strcmp(argv[i], "-Osize")) {
+			objective = OBJECTIVE_SIZE;
+		} else if (!strcmp(argv[i], "-Ospeed")) {
+			objective = OBJECTIVE_SPEED;
+		} else if (!strcmp(argv[i], "--max-steps")) {
+			if (i + 1 == argc)
+				fatal_error(-1, "expected a number after --max-steps.");
+
+			max_steps = strtoll(argv[++i], NULL, 0);
+		} else if (!strcmp(argv[i], "--cell-bits")) {
+			if (i + 1 == argc)
+				fatal_error(-1, "expected a number after --cell-bits.");
+
+			int bits = strtol(argv[++i], NULL, 0);
+			if (bits != 8 && bits != 16 && bits != 32)
+				fatal_error(-1, "cells can be 8, 16 or 32 bits wide, not \"%s\".", argv[i]);
+
+			set_cell_bits(bits);
+		} else if (!strcmp(argv[i], "-target")) {
+			if (i + 1 == argc)
+				fatal_error(-1, "expected a target after -target.");
+
+			if (!strcmp(argv[++i], "c")) {
+				target = TARGET_C;
+			} else if (!strcmp(argv[i], "bf")) {
+				target = TARGET_BF;
+			} else {
+				fatal_error(-1, "unknown target \"%s\", expected \"bf\" or \"c\".", argv[i]);
+			}
 		} else {
 			input_path = argv[i];
 		}
 	}
 
-	if (!input_path || !output_path)
-		fatal_error(-1, "Usage: bfm INPUT_PATH -oOUTPUT_PATH");
+	/* after the other options, so it checks with the cell width they ask for */
+	if (check_algos)
+		return check_algorithms();
+
+	if (!input_path || (!output_path && !run))
+		fatal_error(-1, "Usage: bfm INPUT_PATH [-oOUTPUT_PATH] [-target bf|c] [--run] [--no-jit] [--stats] [--max-steps N] [--size-report] [-Osize|-Ospeed] [--cell-bits 8|16|32] [-v] [--check-algorithms]");
 
 	raw = load_file(input_path);
 
 	if (!raw)
-		fatal_error(-1, "Usage: bfm INPUT_PATH -oOUTPUT_PATH");
+		fatal_error(-1, "Usage: bfm INPUT_PATH [-oOUTPUT_PATH] [-target bf|c] [--run] [--no-jit] [--stats] [--max-steps N] [--size-report] [-Osize|-Ospeed] [--cell-bits 8|16|32] [-v] [--check-algorithms]");
 
 	Token *tok = tokenize(raw);
 	check_errors();
@@ -2268,20 +6536,76 @@ int main(int argc, char **argv)
 	temp_cells   = estimate_variables(&tok) + 4;
 	temp_x       = temp_cells - 4,   temp_y = temp_cells - 2;
 	temp_x_index = temp_x + 1,       temp_y_index = temp_y + 1;
-	arrays = temp_cells + NUM_TEMP_CELLS;
+	reserve_wide_cells();
+	arrays = temp_cells + num_temp_cells;
 
-	add_variable("null", -1, VAR_CELL, temp_cells + NUM_TEMP_CELLS - 1, -1, -1, -1);
+	add_variable(intern("null"), 1, VAR_CELL, temp_cells + num_temp_cells - 1, -1, -1, -1, ARRAY_WALK);
 	parse(tok);
-	free(raw);
-	delete_list(tok);
 
-	sanitize(output);
+	long raw_bytes = count_bytes(code, code_len);
+
+	code_len = optimize(code, code_len);
+	code_len = optimize(code, propagate_constants(code, code_len));
+
+	double compile_ms = elapsed_ms(&start);
+
+	if (verbose)
+		print_optimizer_report();
+
+	if (size_report)
+		print_size_report(code, code_len);
+
+	if (output_path && target == TARGET_C) {
+		lower_code(code, code_len);
 
-	FILE* output_file = fopen(output_path, "w");
-	save_file(output_file, output);
-	fclose(output_file);
+		FILE* output_file = fopen(output_path, "w");
+		save_c_source(output_file, ops, ops_len);
+		fclose(output_file);
+	} else if (output_path) {
+		char* output = render_code(code, code_len);
 
-	free(output);
+		FILE* output_file = fopen(output_path, "w");
+		save_file(output_file, output);
+		fclose(output_file);
+
+		free(output);
+	}
+
+	if (run) {
+		lower_code(code, code_len);
+#ifdef HAVE_JIT
+		/* only the interpreter counts steps */
+		if (print_stats || max_steps >= 0 || !use_jit || cell_bits != 8 || !jit_run(ops, ops_len))
+#endif
+		{
+			unsigned* tape = bfm_malloc(TAPE_SIZE * sizeof(unsigned));
+			memset(tape, 0, TAPE_SIZE * sizeof(unsigned));
+
+			if (run_operations(ops, ops_len, tape, TAPE_SIZE, stdin, stdout))
+				fatal_error(-1, "the program moved the pointer off of the tape.");
+
+			free(tape);
+		}
+		free(ops);
+	}
+
+	if (print_stats) {
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+
+		fprintf(stderr, "compile_ms=%.3f\tpeak_kb=%ld\tarena_kb=%zu\tarena_allocs=%ld\traw_bytes=%ld\toptimized_bytes=%ld",
+		        compile_ms, usage.ru_maxrss, compile_arena.peak_reserved / 1024, compile_arena.allocations,
+		        raw_bytes, count_bytes(code, code_len));
+
+		if (run)
+			fprintf(stderr, "\tsteps=%lld", steps_executed);
+
+		fputc('\n', stderr);
+	}
+
+	free(code);
+	arena_release(&compile_arena);
+	free(raw);
 
 	return 0;
 }
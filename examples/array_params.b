@@ -0,0 +1,25 @@
+>>>>>>>>>>>>>>>>>>>>++++++++[>+++++++++<-]<<<<<<<<<<<<<<<<<<++++++++[<++++++++>-
+]<+[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<[-]<
+++++++[>+++++++++++<-]>[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<+<<<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>>>>>>>>>>>[>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]
+<<+[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]<<<[-]<++++[>>>
+>>>[-]<[-]<<<<[>>>>+>+<<<<<-]>>>>>[<<<<<+>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]
+>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<
+<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]
+>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]
+>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]>[-]>[-]>[-
+]>[-]>[-]>[-]>[-]<<<<<<<<<[>>+>+<<<-]>>>[<<<+>>>-]<[>>+<<-]>+>[<->[>++++++++++<[
+->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>
+++++++++[<++++++>-]]<[.[-]<]<[-]++++[>++++++++<-]>.<<<[-]+[<<<+>>>-]+[<<<<->>>>-
+]<<<<]>>>>>>>[-]++++++++++.<<<<<<[-]<++++[>>>>>>[-]<[-]<<<<[>>>>+>+<<<<<-]>>>>>[
+<<<<<+>>>>>-]<[->>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<
+<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>
+>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<[>>+>+<<<-]>>>[<<<+>>>-]<
+[>>+<<-]>+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-
+]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<[-]++++[>++++++++<-]>.
+<<<[-]+[<<<+>>>-]+[<<<<->>>>-]<<<<]>>>>>>>[-]++++++++++.
\ No newline at end of file
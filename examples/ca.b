@@ -1,169 +1,142 @@
->>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++.++++++++
-++.--------------------------.++++++++++++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++.+++.---------.-------.-------------------------
---------------------------------------------.+++++++++++++++++++++++++.---------
-.--------------------------------------.+++++++++++++++++++++++++++++++++++++++.
-+++++++++.--------------------------.+++++++++++++++++++++++++++++++++++++++++++
-+++++++++++++++++++++++++++++++++++++++.+++.---------.-------.------------------
----------------------------------------------------.+++++++++++++++++++.---.----
-----------------------------------.++++++++++++++++++++++++++++++++++++++++.++++
-++++.--------------------------.++++++++++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++.+++.---------.-------.-----------------------
-----------------------------------------------.+++++++++++++++++.++++.-----.----
-----------------------------------.+++++++++++++++++++++++++++++++++++++++++.+++
-++++.--------------------------.++++++++++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++.+++.---------.-------.-----------------------
-----------------------------------------------.+++++++++++++++++..-.------------
---------------------------.<<<[-]+++++++++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++[->>>>>>>>>>+>+<<<<<<<<<<<]>
->>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>
->>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[-
->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<
-<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]+[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>
->>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>
-[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<
-<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<
-<<[->>>>+<<<<]>>-]<<<<<<<<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.+++.---------.-
-------.-------------------------------------------.--------------------------.[-
-]>[-]+[[-]>[-],[+[-----------[>[-]++++++[<------>-]<--<<[->>++++++++++<<]>>[-<<+
->>]<+>]]]<]<[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]++++++++++++++++++++++++++
-+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.--
-.+++++++++.---------.+++++++++++++.-----------------.+++++++++++++++++++.-------
-----.++++++.-.+++++.---------------------------------------------------------.--
-------------------------.[-]>[-]+[[-]>[-],[+[-----------[>[-]++++++[<------>-]<-
--<<[->>++++++++++<<]>>[-<<+>>]<+>]]]<]<[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
->-]<<<<<<<<<<<<<<<<<<<<[->>[-]++++++++++++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++[->>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>>>>>
-+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<
-<<<<<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-++>>>>>>>>>>>>>>>>>[-]<<<[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<
-<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<[->>>>>>>>>>+>+
-<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<
-<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<
-+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<[-]>>>>>>>>
->>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<[-]<[-]<<<<<<<<<<<<<<<<[>>>>>>>>
->>>>>>>>+>+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
->>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+>>+<
-<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+
-<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<[-]>>>>>>>>>>>
->[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<[-]>>[<<+>>>>+<<-]>>[<<+>>-]<<<<[-
->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<[-
->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>
->+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->
-+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
-]>[-]+>[-]<[>>>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+>+<<<<<<<<<<
-<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<[->>>>>>>>+>+<<<<<<
-<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<
-<<<+>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<
-+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>
->>>]<<<<<<<<<<[-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>>>+<
-<-]>>[<<+>>-]<<<<[-]<<<<<<<<<<<[>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>
->[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<[>>>>[-]+++++++++++++++++++++++++++++++++
-++.<<<<[-]]>>>>[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>
->>>>>[<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>-]<<<<[-]<<<<<<<<<<<[>>>>>>>>>>>+>>>>+<<<<<
-<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<[>>>>[-]+++++++
-+++++++++++++++++++++++++.<<<<[-]]<<<<<<<<<<<<+>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<
-<<<[-]>[<+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+
->>>>>>>>>>>>>>>>-]<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+++++++++>>[-]>[-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]+>>>
->>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>[-]]<[-]
-<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>[<<<<
-<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>[-]+++++++++
-+.<<<<<<<<<<<<<<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-++++++[->[-]>>>>>>>>>>>>>>[-]<<<<<<<[-]<<<<<<<<[>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<
--]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<[-]<<<<<<<<<[>>>>>>>>>+
->>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<[-
-]<<<<<<<<<<[>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>
->>>>>>>>>>>>>-]<<<<<<<->>+>>>>>[-]<<<<[-]<<<<<<<<<<<[>>>>>>>>>>>+>>>>+<<<<<<<<<<
-<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<[-]>>[-]>[-]<<<<<[>>>>
->+<<<<<-]+>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<->>>>>[-]]<[-]<<<<[-]>>>>[<<<<+>>>>-]<<<
-<[<<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>[-]]
->>>>[-]<<<<[-]<<<<<<<<<<<[>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<
-<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<[-]++++++++++++++++++++++++++++++++++++++++++++++
-+++++++++++++++++++>>[-]>[-]<<<<<[>>>>>+<<<<<-]+>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<->
->>>>[-]]<[-]<<<<[-]>>>>[<<<<+>>>>-]<<<<[<[-]>[-]]>>>>[-]<[-]<<<<<<[>>>>>>+>+<<<<
-<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>
->]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>>>>]
-<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]
-<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<<<<<<<<<<
-[-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<[>>>>>+>+<<<<<<-
-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<
-<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<
-]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<
-<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<<<<<<<<<[-]>>>>>
->>>>>[<<<<<<<<<<+>>>>>>>>>>>>+<<-]>>[<<+>>-]<[-]<<<<[>>>>+>+<<<<<-]>>>>>[<<<<<+>
->>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+>>+
-<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<
-+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<[-]>>>>>>>>>>
->>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>
->>>>>>>>+<<-]>>[<<+>>-]<<<<<<<<<<[-]<<<[>>>+>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>
->>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<[-]]+>>>>>>>>>>
-[<<<<<<<<<<->>>>>>>>>>-]<<<<<<<<<[-]<<<[>>>+>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>
-[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<[-]]+>>>>>>>>>[<<<<<<<<
-<->>>>>>>>>-]<<<<<<<<[-]<<<[>>>+>>>>>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>
->>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<[-]<<<<
-<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>[<<<<<
-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]<<[-]>>[-]>[-]<<<<[>>>>+<<<<-]+>[>>>-<+<<-]>
->[<<+>>-]>[<<<<->>>>[-]]<[-]<<<<[-]>[<+>>>>+<<<-]>>>[<<<+>>>-]<<<<[>>>>[-]<<<<[-
-]<<<<<<<<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>
->>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<
-[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>
->>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<
--]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]>>>>[-
-]<<<[-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>
->>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]<<[-]+>>[-]>[-]<<<<[>>>>+<<<<-]+>
-[>>>-<+<<-]>>[<<+>>-]>[<<<<->>>>[-]]<[-]<<<<[-]>[<+>>>>+<<<-]>>>[<<<+>>>-]<<<<[>
->>>[-]<<<<[-]<<<<<<<<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<
-+>>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<
-<<+>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>
->>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]>>>>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<
-<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>
->>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>
->>>>>[-]]]>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<
-<+>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<
-<+>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<
-<<<<+>>>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]]>>>>[-]<<<[-]<<<<<<<<<<<<<<
-<<[>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<
-<<<<+>>>>>>>>>>>>>>>>>>>-]<<[-]++>>[-]>[-]<<<<[>>>>+<<<<-]+>[>>>-<+<<-]>>[<<+>>-
-]>[<<<<->>>>[-]]<[-]<<<<[-]>[<+>>>>+<<<-]>>>[<<<+>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<
-<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<
-[>>>>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>
->>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<
-<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]>>>>[-]<<<<[-]<<<<<[>>>>
->+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>
->>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]>>>>
-[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>
->>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>++++++++++++++++[>+>++>+++>++++++>+++++++<<<<<-]>>>.++++++++++
+.<.>>>++.+++.---------.<+++++.<<.>-.---------.<<------.>>+.+++++++++.<.>>>++++++
+.+++.<+++++++.-------.<<.>-------.---.<<.>>++.++++++++.<.>>>---.+++.<+++++++.---
+----.<<.>---------.++++.-----.<<.>>+++.+++++++.<.>>>---.+++.<+++++++.-------.<<.
+>---------..-.<<.>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+++++++++++++[>++>++>++++>+<<<<-]>>>>.>.<------.<+.<.<----.[-]+[[-]>[-],[+[
+-----------[>[-]++++++[<------>-]<--<<[->>++++++++++<<]>>[-<<+>>]<+>]]]<]<[<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>-]>>[-]>[-]<<<+++++++++++++++[>++>++++>+++++++<<<-]>>>--
+.--.>++.<.>++++.<----.>++.<++++++++.++++++.-.>-.<<--.<++.[-]+[[-]>[-],[+[-------
+----[>[-]++++++[<------>-]<--<<[->>++++++++++<<]>>[-<<+>>]<+>]]]<]<[<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>[-]+[<<<<<<<<<<<<<
+<<<->>>>>>>>>>>>>>>>-]<<<[-]>>>++++++[<<<+++++++++++>>>-]<<<[>>>[-]+[<<<->>>-]<<
+<<[-]>>>>>>[-]<<<<<[<+>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]++++++[<<+++++++++++>>-]<
+<[<<<<+>>>>-]<[-]<<[>>+>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<[->>>>>>>>>>>>>>+>+<<<<<
+<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>
+>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[
+-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>
+>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>]<<<<<<<<<<<<<<[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>
+>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<
+<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<
+<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<[-]<<<<[-]>>[<<+>>>>+<<-]>>[<<+>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[-
+>>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<<]+<[-]>[<<[-]>>>>>>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-
+]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<
+<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<
+<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<
+<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<[-]>>>>>[<<<<<+>>>>>>>+<<-]>>
+[<<+>>-]<<<<[-]<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>>[-]<[-]+
+++++[>+++++++<-]>.<<<<<[-]]>>>>[-]<<<<<<<[>>>>>>>+<<<<<<<[-]]+>>>>>>>[<<<<<<<->>
+>>>>>-]<<<<<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>>[-]<[-]++++[
+>++++++++<-]>.<<<<<[-]]>>[-]+[<<<<+>>>>-]>>[-]<<<<<[-]<[>+>>>>>+<<<<<<-]>>>>>>[<
+<<<<<+>>>>>>-]<<<<<-------------------------------------------------------------
+-----[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<<[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>
+-]<<<<<]>>>>>>[-]++++++++++.<[-]++++++[<<<<<+++++++++++>>>>>-]<<<<<<<[-]<<<[-]>[
+-]>>>>[>>>[-]+[<<<->>>-]<<<<[-]<<[-]<<<[-]<[-]<[-]<<<<[-]>[-]>>>>>>>>>>>>>>>>[-]
+<<<<<[<<<<<<<<+>>>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<[<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<[<<<<<<<<<<<+>>>>>>>>>>>>>>>>+<<<<<-]
+>>>>>[<<<<<+>>>>>-]<<+[<<<<<<<<<<<->>>>>>>>>>>-]+[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<[-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-
+]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>[<<<<<<<<<<<
+<<<<->>>>>>>>>>>>>>>-]<<<<[-]<<<<<<<<<<<[>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<-]>>>>>
+>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<[-]+++++++++++++++++++
+++++++++++++++++++++++++++++++++++++++++++++++>>>>>>>>>[-]]<<<<<<<<<<<[-]>>>>>>>
+>>>[<<<<<<<<<<+>>>>>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<<<<<<<<<<<--------
+---------------------------------------------------------[>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<[-]]+>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>
+>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+-]<<<<[<<<<<<<<<<<<[-]>>>>>>>>>>>>[-]]>>>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+>+<<<<<<<<
+<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<
+<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<
+<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>
+-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[
+-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<[-
+]>>>>>[<<<<<+>>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>+<<<<<
+<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<[->>>>>>>>
+>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>
+>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>
+>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>
+>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<[-]<<<<<<<<<<[-]>>>>>>>>[<<<<<<<<+>>>>>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<<<<<<
+<<<<<[>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>
+>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>
+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>
+]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>+<<-]>>[
+<<+>>-]<<<<<<<<[-]>[<+>>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<<<<<[>>>>>>
+>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<<<<<<<<<[-]>[<+>>>>>>>>>>>+<<<<<<
+<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>>>>>+<<<<<<<<<<<[-]]+
+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<<[-]>>>[<<<+>>>>>>>>>>>>+<<<<<<<
+<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<[-]]+>>
+>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>>>>-]<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>
+>+<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>[<<<<<<<<<<<<<->>>>>>>>>>>>>-]<<<<[-]<<<<<<<<<[
+>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[>>
+>>[-]<<<<[-]<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<
+<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[
+<<[-]+>>[-]]]>>>>[-]<<<<<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<
+<[>>>>[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[
+<<[-]+>>[-]]]]>>>>[-]<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>
+>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<-[>>>>>>>>>>>>>+<<<<<<<<<<<<<[
+-]]+>>>>>>>>>>>>>[<<<<<<<<<<<<<->>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>+>>>>+<<<<
+<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<[>>>
++>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+
+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<<[>>
+>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[<<[-]+>>[
+-]]]]>>>>[-]<<<<<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-
+]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[<<
+[-]+>>[-]]]>>>>[-]<<<<<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-
+]<<<<[>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>
 >>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>
->-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<
-<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<[>>>>>+>>>>+<
-<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<
-<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]
-]>>>>[-]<<<[-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>
->>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]<<[-]+++>>[-]>[-]<<<<[>>>>
-+<<<<-]+>[>>>-<+<<-]>>[<<+>>-]>[<<<<->>>>[-]]<[-]<<<<[-]>[<+>>>>+<<<-]>>>[<<<+>>
->-]<<<<[>>>>[-]<<<<[-]<<<<<<<<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<
-<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-
-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<
-<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]>>>>[-]<<<<[-
-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<
-<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<
-<<<<<[-]+>>>>>>>>>>[-]]]]>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>
-[<<<<<<<<<<+>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]
->>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[<<<<<<<<<<[-]+>>>>>>>>>>[-]]>>>>[-]
-<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>[-]<<
-<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<
-[<<<<<<<<<<[-]+>>>>>>>>>>[-]]]]]>>>>[-]<<[-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+>>+<<<<<
-<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<+++++++++++++++++
-+++++++++++++++++++++++++++++++++++++++++++++++++>>[-]<<<[-]>[<+>>>+<<-]>>[<<+>>
--]<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>
->>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[-
->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<
-<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<[-]<<
-<<<<<<<<[>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>
->>>>>-]<<<<[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>
-]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<
-<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>
->]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<
-<<<<<<<<<<]<<<<<]
\ No newline at end of file
+>-]<<<<[<<[-]+>>[-]]]]]>>>>[-]<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]
+>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<--[>>>>>>>>>>>>>+<<<<
+<<<<<<<<<[-]]+>>>>>>>>>>>>>[<<<<<<<<<<<<<->>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>
++>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<
+[-]<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>>
+>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<[>
+>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<[-]+>>[-]]]>>>>[-]<<<
+<<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>
+>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>
+>>>>>>-]<<<<[<<[-]+>>[-]]]]>>>>[-]<<<<<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[
+<<<<<<<<<<+>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<
+<<<<+>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>
+>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[<<[-]+>>[-]]]]>>>>[-]<<<<<<<<<[>>>>>+>>>>+<<
+<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+
+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<[>>>>+>
+>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[<<[-]+>>[-]]]]]>>>>[-]<<<<<<<<<<<
+<<[-]<[>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>-]<<<<<<<<<<<<<---[>>>>>>>>>>>>>+<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>[<<<<<<<<<<<<
+<->>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<
+<<<<<<<<+>>>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<
++>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<
+<+>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>
+>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[<<[-]+>>[-]]]>>>>[-]<<<<<<<<<<<[>>>>>>>+>>>>+
+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<[>>>>>
++>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<[-]+>>[-]]]]>>>>[-]<<<<<<
+<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>
+>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<[<<[-]+>>[-]]<<<<<<<[
+>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]<<<<[
+-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<[-]+>>[-]]]]
+]<<<<[-]>>>>>>>>[-]<<<<<[<<<+>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<[-]<<++++++[>>
++++++++++++<<-]>>[<<<<<<+>>>>>>-]<[-]<<<<<[>>>>>+>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<
++>>>>>>>>-]<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>
+[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>
+]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<[-]<<[>>+>>>
+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[
+>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<
+<<<<<<<<<<<<<<<<<]<<<<<<<<<<<<<]
\ No newline at end of file
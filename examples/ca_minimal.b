@@ -1,85 +1,77 @@
->>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>>>>>>>>>+>+<<<<<<<<<<
-<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>
->>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<
-<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<
-<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]+[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>
->>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>
->>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<
-<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+
->]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<<<<<<<[-]+[>[-]+++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++++[->>>>>>>>>>>>>[-]<<<<<<<<
-<<<<[-]<[>+>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>
--]<<<<<<<<<<<<++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+++++++++++++++>>>>>>>>>>>>[-]<<<[-]<<<<<<<<<<[>>>>>>>>>>+>>>+<<<<<<<<<<<<<-]>>>
->>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>
-[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<
-<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>
-[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
-+>>>>>>>>>>>>>>]<<<<<<<<<<[-]<[-]<<<<<<<<<<<[>>>>>>>>>>>+>+<<<<<<<<<<<<-]>>>>>>>
->>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>
->>>>]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>>
->>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>
->-]<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<[-]>>[
-<<+>>>>+<<-]>>[<<+>>-]<<<<[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<
-<<<+>>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>
->>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]
->[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-
-]<<<<<<<<<<<<<<<<<<<<<<]+>[-]<[>>>>>>>>>>>>>[-]<[-]<<<<<<<<<<<[>>>>>>>>>>>+>+<<<
-<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>
->>>[-<<<<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>
->>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>
-]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<
-<<<<<[-]<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>+<<-]>>[<<+>>-]<<<<[-]<<<<<
-<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]++
-+++++++++++++++++++++++++++++++++.<<<<[-]]>>>>[-]<<<<<<<<<<<[>>>>>>>>>>>+<<<<<<<
-<<<<[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<
-<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>>>[-]++++++++++++++++++++++++
-++++++++.<<<<[-]]<<<<<<<<+>>>>>>>>>>>>[-]<<<<<<<<<<<<<[-]>[<+>>>>>>>>>>>>>+<<<<<
-<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<[-]++++++++++++++++++++++++++
-+++++++++++++++++++++++++++++++++++++++++++++++++++++++>>[-]>[-]<<<<<<<<<<<<<<[>
->>>>>>>>>>>>>+<<<<<<<<<<<<<<-]+>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<-
->>>>>>>>>>>>>>[-]]<[-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>
->[<<<<<<<<<<<<<->>>>>>>>>>>>>-]<<<<<<<<<<<<<]>>>>>>>>>>>>>[-]++++++++++.<<<<<<<<
-<<<<<[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+++++++++[->[-]>>>>>>>>>>>>[-]<<<<<<<[-]<<<<<<[>>>>>>+>>>>>>>+<<<<<<<<<<<<<-]>>>
->>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>+<<<<<<<<
-<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<->+>>>>>>[-]<<<<<[-]<<<
-<<<<<[>>>>>>>>+>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<
-<[-]>>[-]>[-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<
-[-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[<<<[-]++++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>[-]]>>>>[-]<<<<<[-]<<
-<<<<<<[>>>>>>>>+>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]
-<<[-]+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+++++>>[-]>[-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]
-<[-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[<<[-]>>[-]]>>>>[-]<[-]<<<<<<[
->>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<
-<<<<<+>>>>>>>>]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>
->[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->
->>>+<<<<]>>-]<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]
-<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<[>>>>>+>+<<
-<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]
-<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>>>>]<<
-[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<
-<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<<<<<<<[-]>>
->>>>>>[<<<<<<<<+>>>>>>>>>>+<<-]>>[<<+>>-]<<<<<<<<<[-]<<[>>+>>>>>>>>>+<<<<<<<<<<<
--]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<[-]]+>>>>>>>
->>[<<<<<<<<<->>>>>>>>>-]<<<<<<<<[-]<<[>>+>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<
-<<<+>>>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<<[
--]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>
->>[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[<<<<<<<<[-
-]+>>>>>>>>[-]]]>>>>[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>
->>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+
->>>>>>>>>>-]<<<<[<<<<<<<<[-]+>>>>>>>>[-]]]>>>>[-]<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>
-+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<++++++++++
-+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++>>>>>>>>>
->>[-]<<<[-]<<<<<<<<[>>>>>>>>+>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>
->-]<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->
->>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[
-->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<
-<<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<[-]<
-<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<
-[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<<<<<<<
-[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>
->>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[
-->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<<<<<<]<]
\ No newline at end of file
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+[>>>>>>>>>[-]>>>>>
+[-]>[-]<-[>+<---]>----[<<<<<<+>>>>>>-]<<<<<<[>>>[-]+[<<<->>>-]<<<<[-]>>>>>>[-]<<
+<<<[<+>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]+++++++++[<<+++++++++>>-]<<[<<<<+>>>>-]<[
+-]<<[>>+>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[-
+>+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<
+<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<
+<<<<<<<<[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<
+<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>
++<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<
+]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<
+<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]
+<<<<[-]>>[<<+>>>>+<<-]>>[<<+>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>
+>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<
+<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>
+>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[
+>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<
+<<<<<<<<<<<<<<<<<]+<[-]>[<<[-]>>>>>>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+
+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]
+<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>
+>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+
+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<[-]>>>>>[<<<<<+>>>>>>>+<<-]>>[<<+>>-]<<<<[-]
+<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>>[-]<[-]+++++[>+++++++<-
+]>.<<<<<[-]]>>>>[-]<<<<<<<[>>>>>>>+<<<<<<<[-]]+>>>>>>>[<<<<<<<->>>>>>>-]<<<<<<<[
+>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>>[-]<[-]++++[>++++++++<-]>.<
+<<<<[-]]>>[-]+[<<<<+>>>>-]>>[-]<<<<<[-]<[>+>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<
+<<<<----------------------------------------------------------------------------
+-----[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<<[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>
+-]<<<<<]>>>>>>[-]++++++++++.<[-]>[-]<-[>+<---]>----[<<<<<<+>>>>>>-]<<<<<<<<[-]<<
+[-]>>>>[>>>[-]+[<<<->>>-]<<<<[-]<<[-]<<[-]<<[-]<[-]>>>>>>>>>>>>>[-]<<<<<[<<<<<<<
++>>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<[<<<<<<<<+>>>>>>>>>>>>>+<<<<<-]>>>>
+>[<<<<<+>>>>>-]<<+[<<<<<<<<<<->>>>>>>>>>-]+[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<[-
+]>>>>>>[<<<<<<+>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<<<<<<<[>>>>>>>>>>>+<<<
+<<<<<<<<[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<
+<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<<<<[-]>>>>>>>>>>>>[-]+
++++++++[<<<<<<<<<<<<++++++++++>>>>>>>>>>>>-]<<<<[-]]>>>>[-]<<<<<<<<<<<[-]>>>>>>[
+<<<<<<+>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<<<<<<<------------------------
+--------------------------------------------------------[>>>>>>>>>>>+<<<<<<<<<<<
+[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]
+>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<<<<<[-]>>>>>>>>>[-]]>>>[-]<<<<<<<
+<<<<[>>>>>>>>>>>+>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<[->>>>
+>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->
+>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<
+<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<
+<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<[-]<<<<<<<[-]>>>>>[<<<<<+>>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<<<<<<<<[>>>>>
+>>>>>>>+>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<[->>>>>>>>>
+>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>
+>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>
+>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>
+-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<
+<<<<<<[-]<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>+<<-]>>[<<+>>-]<<<<<<<<[-]>[<+>>>>
+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<
+<<<<<<<->>>>>>>>-]<<<<<<<<<<[-]>[<+>>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>
+>>>>>>-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<[-]]+>>>>>>>>>>[<<<<<<<<<<->>>>>>>>>>-]<
+<<<[-]<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<<<<<[>
+>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<[<<[-]+>>[-]]]>>>>[
+-]<<<<<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[>>>>[-]<<<<[-]<<
+<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<[-]+>>[-]]]<<<<[
+-]>>>>>>>>[-]<<<<<[<<<+>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<[-]<<+++++++++[>>+++
+++++++<<-]>>[<<<<<<+>>>>>>-]<[-]<<<<<[>>>>>+>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>
+>>>>-]<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[
+->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>
+>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<[-]<<[>>+>>>>+<<<
+<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<<<<<<
+<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>
+>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-
+<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<
+<<<<<<<<<<<<]<<<<<<<<<]
\ No newline at end of file
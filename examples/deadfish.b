@@ -1,25 +1,25 @@
-[-]+>[-]<[>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-++++..------------------------------.<<<<<<<[-]+[>,>>>>>>[-]<<<<<[-]<[>+>>>>>+<<
-<<<<-]>>>>>>[<<<<<<+>>>>>>-]>[-]<-[>++<-----]>+++<<<[-]>>>[<<<+>>>-]<[-]>[-]<<<<
-<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<[-]<<<<[-]<[>+>>>
->+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>[-]+[<<<<<<+>>>>>>-]<<[-]]>>>>[-]<<<<<[-]<[>+
->>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>[-]<-[>++<-----]>--<<<[-]>>>[<<<+>>>-]<[-]>
-[-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<[-]<<<<[-]
-<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>[-]+[<<<<<<->>>>>>-]<<[-]]>>>>[-]<<<<<
-[-]<[>+>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>[-]<-[>++<+++++++++]>+<<<[-]>>>[<<<+
->>>-]<[-]>[-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<
-[-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>[-]<<[-]<<<<<<[>>>>>>+>>+<
-<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>>>
->[<<<[<<<<<<+>>>>>>>>+<<-]>>[<<+>>-]>-]<<<<<[-]]>>>>[-]<<<<<[-]<[>+>>>>>+<<<<<<-
-]>>>>>>[<<<<<<+>>>>>>-]>[-]<-[>--<-------]>+<<<[-]>>>[<<<+>>>-]<[-]>[-]<<<<<<[>>
->>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<[-]<<<<[-]<[>+>>>>+<<<
-<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<[>
->>>>>>>+>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<[>>+>+<<<-]>>>[<<<+>>>-]<<+
->[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]
->[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<[-]++++++++++.<<<<[-]]>>>>[-]<<<
-<<[-]<[>+>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>[-]<-[>++<-----]>++<<<[-]>>>[<<<+>
->>-]<[-]>[-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<[
--]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[<<<<<[-]>>>>>[-]]>>>>[-]<<<<<<<
-[-]>[<+>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<[-]++++++++++>>[-]>[-]<<<<<<<<[>>
->>>>>>+<<<<<<<<-]+>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<->>>>>>>>[-]]<[-]<<<<<<<[>
->>>>>>+<<<<<<<[-]]+>>>>>>>[<<<<<<<->>>>>>>-]<<<<<<<]<<]
\ No newline at end of file
++[>>>>>>>>>>[-]>[-]<<[-]++++++++[>++++>++++++++<<-]>>--..<.<<<<<<<<<[-]+>>[-]<<[
+>>,>[-]>>>>>[-]<<<<<<[>+>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<---------------
+--------------------------------------------------------------------------------
+----------[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<
++>>>>>-]<<<<[>>[-]+[<<<<<+>>>>>-]<<[-]]<[-]<[>+>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>
+>-]<<<<<------------------------------------------------------------------------
+----------------------------[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<<[>+>>>>+<<<
+<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>[-]+[<<<<<->>>>>-]<<[-]]<[-]<[>+>>>>>+<<<<<<-]>>>>
+>>[<<<<<<+>>>>>>-]<<<<<---------------------------------------------------------
+----------------------------------------------------------[>>>>>+<<<<<[-]]+>>>>>
+[<<<<<->>>>>-]<<<<<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>[-]<<[-]<<<<<[>>>>
+>+>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]>[-]<<<<<<<<[>>>>>>>>+<<<<<<<<-]>>>>>>>>[
+<<<[<<<<<+>>>>>>>+<<-]>>[<<+>>-]>-]<<<<<[-]]>>>>[-]<<<<<[-]<[>+>>>>>+<<<<<<-]>>>
+>>>[<<<<<<+>>>>>>-]<<<<<--------------------------------------------------------
+-------------------------------------------------------[>>>>>+<<<<<[-]]+>>>>>[<<
+<<<->>>>>-]<<<<<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>[-]>[-]>[-]>[-]>[-]>[
+-]>[-]>[-]<<<<<<<<<<<<<<[>>>>>>>+>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<[>>+<<
+-]>+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+
+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]++++++++++.<<<<<[-]]>>>>[-]<<
+<<<[-]<[>+>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<-----------------------------
+---------------------------------------------------------------------------[>>>>
+>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[<<<<<
+[-]>>>>>[-]]<<<<[-]>>[<<+>>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<--------
+--[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<[
+-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<<<<<<]<]
\ No newline at end of file
@@ -1,372 +1,358 @@
-[-]+[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++..------------------------------.<<<<<<<<<<<<<<<<<<<<<<<<<
-<<<<[-]+[>,>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]-<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>
->>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]-<<<<<
-<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
->>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[
--]<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
-<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<
-<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>
->>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<-]+<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<
-<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>
->>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>
-[-]]<[-]<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<
-<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<
-<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>
->>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]+<<[>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<
-<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
->>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]>[
--]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<-
-]>>>>>>>>>>>>>>>>>>>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+
-<+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
->>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>[-]]]<[
--]<<<<[-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
--]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<
-<<[<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>>>>>>[-]]>>>>[-]<<<<[-]<<<<<<<<<
-<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
->>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<
-<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<
-<<<<<<<<<[-]>[-]+<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[-]<
-<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
->>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
->>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
-<<<<<<<<<<<-]+<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>
->>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<
-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<<<<<<<<<<<<<<<<<<<
-<[-]<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>
->>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>
->>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
-<<<<<<<<-]+<<[>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>
->>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<
-<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>
->>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[[-]
-<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<-]>>>
->>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<
-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<<<<[
->>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<
-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<<<<<<[-]+
->>>>>>>>>>>>>>>>>>>>>>>[-]]>>>>[-]<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>
->>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<
-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<
-[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<[>+>>
->>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>
->>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<-[>++<-----
-]>+++<<<[-]>>>[<<<+>>>-]<[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>
->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[
-<<+>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-
-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
-<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
->>>>>>-]<<<<[>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>>>>>>>>>
->>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<
-<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]-<<[-]>>[<<+>>-]>[-]<<
-<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
-<-]+>>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<->
->>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>
->>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
-<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<
-<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
->>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<[>+>>>>>>
->>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<-[>++<-----]>--
-<<<[-]>>>[<<<+>>>-]<[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>
->>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>
--]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<
-<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>
->>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>
->-]<<<<[>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>
->>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
-<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]>>[-]>[-]<<<<<<<<<<<<<
-<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>>>>
->>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>
->>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+>>>>
-+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<
-<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>
->>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>
->>>>>>>>>>>>>>-]<<[-]]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>>>>>
->>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<
-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<-[>++<+++++++++]>+<<<[-]>>
->[<<<+>>>-]<[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<
-<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<
-<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<
-<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>
->>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[
->>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<
-<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<
-<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<[>
->>>>+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>
->>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<
-<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
-<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>
->>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>
->>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<
-<<<<<<<<<[-]<<<<[>>>>+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
->>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]
->>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
--]+>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>
->>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<
-<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
->>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<
-<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[-]+[>>>>>
->>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<[-]<<<[>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<
-<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
->>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[-]<<<[>>>+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
-<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
->>>>-]<<<<<<<<<<<<<<<<<<<[-]+[>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<[-]<<<<<<[
->>>>>>+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<
-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]>>[-]>[-]<<<<<<<<<<<<<<<<<<
-<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]+>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-
-]>[<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<[>>>>>>>>
->>>>>>+>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
->>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[
-<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>-]>>[-]<<<<<<<<<<<<<<<<<<[-]<<<<<<<
-<<<<<<[>>>>>>>>>>>>>+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
->>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
->>>>>>>>-]-<<[-]>>[<<+>>-]>[-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<
-<<<<<<<<<-]+>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<->>>>>>>>>
->>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<-]
->>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<
-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<
-<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>>[-]<<<<<<<<<<<<<<<<<<<[-]<<<<<[>>>>
->+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<
-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>
->>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<->>>>>>
->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<
-<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
->>>>>>-]>[<<<<<<<<<<<<<<<<<<<<[-]->>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<]>
->>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>[<<<+>>>>>>>>>>>>>>>>>>>>>>>>
++[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]>[-]<<[-]++++++++[>++++>++++++++<<-]>
+>--..<.<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>[-]>[-]>>>[-]<[-]<<<<[>,>>[-]>>
+>>>>>>>>>>[-]<<<<<<<<<<<<->>>>>>>>>>>>-<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-]>>>>>>>>
+>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>+>>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<<-]+<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<->>>
+>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<[>>>>+>>>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>[>>>>>>>>>>>>>>>>>>>>>>-<
 +<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
->>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<[-]>>>[<<<+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<
-<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<
-<<<<<<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-
-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
->-]<<[-]>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
-<<<<<-]+>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<<<<->>>>>>>
->>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<
-<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-
-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<
-<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>-]>>[-]<<<<<<<<<<<<<<<<<<<<<<[-]<<<<
-[>>>>+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>
->>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<
-<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[
-<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>
->>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[
-<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<[-
-]->>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>[-]]>>>>[
--]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
-<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
->>>>>>>>>>>>>>>>>>>>-]>[-]<-[>--<-------]>+<<<[-]>>>[<<<+>>>-]<[-]>[-]<<<<<<<<<<
-<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>
->>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>
->>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>
->>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<
-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<<<<<[-]>>>>
->>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<[>>>>>>+>>>>>>>>>>>>>
->>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<
-<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<
-<<<<<<<[-]<<<<<<[>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-
-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>
->>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<[-]+[>[-]>[-]++++++++++>>>>>>>>>>>>>>>>>>>
->>[-]<<<<<<<<<<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
-<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
->>>>>-]<<<<<<<<<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
-<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
->-]<<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<[-]<<<<<<<[>
->>>>>>+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
-<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<[-]<<<<<<<<<[>>>>>>>>>+>>>>>>>>>>>>
->+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
->>>>>>>>>>>>>>-]<<<<<<<<<<<<[-]>[-]>[-]>>>>>>>>>>[-]<<<<<<<<<[-]<<<<<<<[>>>>>>>+
->>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]
->[-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>-<+<<<<<
-<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-
-]>[<<<<<<<<<<->>>>>>>>>>[-]]<[-]<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>>>+<<<<<<<<<<<<
-<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<
-<<<<<<<-]+<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>
->>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<->>>>>>>>>[-]]<[-]>[-]
-<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[[-]<<<<<<<<<[>>>>>>>>>+<+<<<<<<<<-]
->>>>>>>>[<<<<<<<<+>>>>>>>>-]>[<<<<<<<<<<+>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<[>>>>>+>
->>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<<<<<[-]+>>>>>>[-]]>>>>[-]<<
-<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<[-]]+>>>>>>>>>>[<<<<<<<<<<->>>>>>>>>>-]<<<<<<<<<<[
->>>>>>>>>>[-]<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>
->>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]-<<[-]>>[<<+>>-]>[-]<<<<<<<<<<[>>>>>>>>
->>+<<<<<<<<<<-]+>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<->>>>>>>>>>[-]]<[-]<<<<[
--]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<
-<<<<<<+>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]>>[-]<<<<<<<<<
-[-]<<<<<<<<<<<<[>>>>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>
->>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<[-]>>[-]>[-]<<<<<<<<<<[>>>>>>
->>>>+<<<<<<<<<<-]+>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<->>>>>>>>>>[-]]<[-]<<<
-<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>[-]+[<<<<<
-<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<->>>>>>>>>
->>>>>>>>>>-]>>[-]<<<<<<<<<[-]<<<<<<<<<<<<[>>>>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<
-<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]>[-]<
-<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<->>>>>>>>>>[-]]<<<<<<<<<<<
-<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>
->>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<[-]->>>>>>>>>>[
--]]<[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<[-]]+>>>>>>>>>[<<<<<<<<<->>>>>>>>>-]<<<<[-]<
-<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>[-]<<<<<<<<[-
-]<<<<<<<<<<[>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<
-<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]-<<[-]>>[<<+>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-
-]+>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<->>>>>>>>>[-]]<[-]<<<<[-]<<<<[>>>>+>>>>+
-<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
->-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]>>[-]<<<<<<<<<<<<<<<<<<<<<[-]
->>>>>>>[<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<
-<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>
->>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[-]]>>>>[-
-]<<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<
-+>>>>>>>>>>>>>>-]<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<
-<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<[-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+>>>>>>>>+<<<<<
-<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
->>>-]<<<<<<<[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<-]>
->>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<[-]+[
->>>>>>[-]<<<<<[-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<<<<<-]
->>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<[-]>>[-]>[-
-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<[-]<<<<[-]<[
->+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>
->>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>-]>>[-]<<<<<[-]<<<<<
-<<[>>>>>>>+>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<[-]>>[-
-]>[-]<<<<<<[>>>>>>+<<<<<<-]+>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<->>>>>>[-]]<[-]<<<<[
--]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>[-]+[<<<<<<<<<->>>>>>>>>-]<<[-]]>>[-
-]+[<<<<<<<<<<->>>>>>>>>>-]>>[-]<<<<<<[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+>>>>>>+<
+>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<
+<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[[
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<
+<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>-]>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<<<<<<<<<<<
+<[>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<
+<<<<<<<<<<<<<<<<<<<<<[-]<[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[-]>>>>>>>>>>>>[-]+<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-]<<<<<<<<[>>>>>>>>+>>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]+>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
+<<<<<->>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<[>>>>+>>>>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<
+<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>[>>>>>>>>>>>>>>>
+>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<
+<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>
+>>>>>>>[[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<
+<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>[-]]]<[-]<<<<<<<<<<<<<
+<<<<<<<[>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<
+<<[<<<<<<<<<<<<<<<<<<<<<<<<[-]<[-]>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<---------
+--------------------------------------------------------------------------------
+----------------[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<
+<<<[<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>
+>>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<
+<<<<<<+[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>[<<
+<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>-]<<<<[-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<
+]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<---------------------------------------------------------
+-------------------------------------------[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<[-]
+]+>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>-]<<<<[-]<<<<
+<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>
+>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<
+<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>
+>>>>>>>>>>>>>>>>>>>>>>-]<<]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<[>>+>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-------------------------------
+--------------------------------------------------------------------------------
+----[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]+>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[>>>>[-]<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>[<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>[<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<
+<<<<<<<<<<[-]>[-]<<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<<<[>>>>>>+>
+>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<
+<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<[-]]+>>>
+>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<
+[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<-]>
+>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]<<
+<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>
+>[-]+[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<
+<<<<<<<<<<[-]+[<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>[-]>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<
+[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
+>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>
+>>>>>>>+>>>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>-]<<<<<[-]+[<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<
+<<<<<<<[>>>>+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>-]<<<<[-
+]<<<<<<<<<<<<<[>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>-]<
+<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[-]<<<<<<<<<
+<<[>>>>>>>>>>>+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<<<+[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<->>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<-
+]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<[-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>>>+<
 <<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
->>>>>>>-]>[-]<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<->>>>>>>[-]]<<<<<<<<<<<<<<<
-<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>
->[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<[-]->>>>>>>[-]]<<<<<<<
-]>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>
->>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>
->>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<
-<<<<<<[-]>>>>>>>>>>[-]<<<<<<<<[-]<<<<<<<<[>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<-]>>
->>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<
-<<<-]+<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
->>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<->>>>>>>>>[-]]<[-]<<
-<<<<<[-]<<<<<<<<[>>>>>>>>+>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
-<<+>>>>>>>>>>>>>>>-]>[-]<<<<<<<<[>>>>>>>>+<<<<<<<<-]+<<<<<<<<<<<<[>>>>>>>>>>>>>>
->>>>>>-<+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
->>>>>>>>>-]>[<<<<<<<<->>>>>>>>[-]]<[-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>>
->>[[-]<<<<<<<<[>>>>>>>>+<+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]>[<<<<<<<<<+>>>>>>>>
->[-]]]<[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[<<<<<
-<[-]+>>>>>>[-]]>>>>[-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<[-]]+>>>>>>>>>>[<<<<<<<<<<
-->>>>>>>>>>-]<<<<<<<<<<]>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>[<<<<<<<<+>>
->>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<
-<<<<<<<<<<<<[-]>>>>>>>>[<<<<<<<<+>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<
-<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>>>>>>>>>
->>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<
-<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>
->>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>
->>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<
-<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>
->[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->>>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<
-<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]
->[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
-<+>>>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<[-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>>+<<<<
-<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
--]<<<<[->>>>>>>>>>>+>>>+<<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>>>>>>>>>>]<<<<
-<<<<<<[->>>>>>>>>>+>+<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]<<<<<<<<<<[->
->>>>>>>>>+>>+<<<<<<<<<<<<]>>>>>>>>>>[-<<<<<<<<<<+>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[-
->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<[-]+[<<<
-<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>
->>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
-<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<
-<<<<<<<<[-]<<<<<<<<<[>>>>>>>>>+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>
->>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<[-]>>>>>>
->>>>>>[-]<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
->[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-
-]+<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
->>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<
-<<<<<<->>>>>>>>>>>>[-]]<[-]<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>+<<<<<<<<<<<<<<<-]
->>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<[>>>>>>>>>>>+<<<
-<<<<<<<<-]+<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<-]
->>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<
-<<<<<<<<<->>>>>>>>>>>[-]]<[-]>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>
->>>>>[[-]<<<<<<<<<<<[>>>>>>>>>>>+<+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-
-]>[<<<<<<<<<<<<+>>>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>
->>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<<<<[-]+>>>>>>>>[-]]>>>>[-]<<<<<<<<<
-<<<[>>>>>>>>>>>>+<<<<<<<<<<<<[-]]+>>>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>>>>-]<<<<<<
-<<<<<<[>>>>>>>>>>>>[-]<<<<<<<<<<<[-]<<<<<[>>>>>+>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>
->>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]-<<[-]>>[<<+>>-]>[-]<<<<<<<<<<
-<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]+>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<->>>>
->>>>>>>>[-]]<[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<
-+>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<
-<<+>>>>>>>>>>>>>>-]>>[-]<<<<<<<<<<<[-]<<<<<<<<<<[>>>>>>>>>>+>>>>>>>>>>>+<<<<<<<<
-<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>
--]<<[-]>>[-]>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]+>>>>>>>>>[>>>-<+<<-]>>[
-<<+>>-]>[<<<<<<<<<<<<->>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<
-<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<<<<<->>>>>>>
->>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>-]<<<<<<<<<[-
-]>[-]>>>>>>>>>>[-]<<<<<<<<<[-]<<<<<<<<<<<<[>>>>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<
-<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]>[-]
-<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+<<[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<
-<<<<<<<<<+>>>>>>>>>>>-]>[<<<<<<<<<<->>>>>>>>>>[-]]<[-]<<<<<<<<[-]<<<<<<<<<<<<<<[
->>>>>>>>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<
-<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]+<<<[>>
->>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>[<<<<<<<<<->>>>>
->>>>[-]]<[-]>[-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[[-]<<<<<<<<<[>>>>>>
->>>+<+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]>[<<<<<<<<<<+>>>>>>>>>>[-]]]<[-]<<<<
-[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<<<<<[-]+>>>
->>>[-]]>>>>[-]<<<<[-]<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>
->>>>-]<<<<[>>>>[-]<<<<<<<<<[-]<<<<<<<<<[>>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]
->>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]-<<[-]>>[<<+>>-]>[-]<<
-<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<->>>>>>
->>>>[-]]<[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<
-<<[>>[-]+[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<<<<+>>>>>>>
->>>>>>>>>-]>>[-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<
-<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<
-<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<
-<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[-]]<<<<<<<<[-]>>>>>>>>>>>>[-]<<<<<<<<<[-]<<<<<<<[
->>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>
->>>>>>-]>[-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>
->>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<
-<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<->>>>>>>>>>[-]]<[-]<<<<<<<<[-
-]<<<<<<<[>>>>>>>+>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>
->>>>>>>>>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>
->>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
-<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<->>>>>>>>>[-]]<[-]>[-]<<<<<<<<<<[>
->>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[[-]<<<<<<<<<[>>>>>>>>>+<+<<<<<<<<-]>>>>>>>>[<<<
-<<<<<+>>>>>>>>-]>[<<<<<<<<<<+>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<
-<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<<<<<<<[-]+>>>>>>>>[-]]>>>>[-]<<<<<<<<<<
-<<[>>>>>>>>>>>>+<<<<<<<<<<<<[-]]+>>>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>>>>-]<<<<<<<
-<<<<<]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>>>>>>>
->>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
->>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>+<<<
-<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<
-<<<<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>
->>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+
->>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-
-]<<<<<<<<<<<<<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
-<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>
->-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<
-<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>[-]
-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<-
-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]>[<
-<<<<<<<<<<<<<<<<<<<<<<<[-]->>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<]
->>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<[-]<<<<[>>>>+>>>>>>>>>>>>>>>>>>>
->>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<
-<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>[-]
-+[<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>-]>>[-]<[-]<<<<<<<<<<<<<<<<<<<<<[>>>>
->>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
-<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<[->>>>>>>>+>+<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>
->>>>>]<<<<<<<<[->>>>>>>>+>>+<<<<<<<<<<]>>>>>>>>[-<<<<<<<<+>>>>>>>>]>[>>>[-<<<<+>
->>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]
->>-]<<<<<<<<<<<[-]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<[-]<<<<<<<<<
-<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<-
-]>>[<<+>>-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>
->>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<
-<+>>>>>>>>>>>>>>>>>>>>>>-]<[>>+>+<<<-]>>>[<<<+>>>-]<<+>[<->[>++++++++++<[->-[>+>
->]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>+++++++
-+[<++++++>-]]<[.[-]<]<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-]++++++++++
-.<<<<[-]]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<[>+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<
-<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<
-<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<-[>++<-----]>++<<<[-]>>>[<<<+>>>-]<[-]>
-[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
-<<<<<<<<<-]+>>>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<<<<<<<<<<<<
-<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>
->>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>
->[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<
-<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
-<<<[-]>[<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>
->>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<
-[-]++++++++++>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>
->>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]+>>>>>>>>>>>>>>>>>>>>>>>>>>>[>>>-<+<<-]>>[<<
-+>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<[-]<<<<
-<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
-<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>
->>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]<<<]
\ No newline at end of file
+>>>>>>>-]>[-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>[<<<<<<->>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<
+[>>>>>>>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<[-]->>>>>>[-]]<<<<<<]>>>>>[-]<<<<<<<<<<<<
+<<<<<<<<<[-]<<<<<<<<<[>>>>>>>>>+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<[>
++>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>
+>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[>>[-]+[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<[-]
+<<<<<<[>>>>>>+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>
+>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>+<+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]->>>>>>>>>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>>>>>>>>[-]]>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<----------------------------------------
+-----------------------------------------------------------------------[>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<[-]>
+[-]>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>+>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]<<<<[>>>>
++>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]+>>>>>>>[-]<[-]>>>>>[-]<<<<<<<[-]<[-]>>>>>[-]<<<<<<<<[>>>>
+>>>>>>>>>>>>>>>>>>>>[-]>[-]++++++++++<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>[-]<<<<<<<<
+<<<<<<<<<<<<[>>>+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[-]<<<<<<<[>>>>>>>+>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[-]<[-]>>>>[-]<[-]<<<<
+<<<<<<[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<-]>>
+>>>[<<<<<+>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-]<[-]<<<<<<<<<[-]>>
+>>>>>>[-]>>>>>>>>>>>>[-]<<<<<<<<<<<<+<<<<<<[>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<
+<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<->>>>>>
+>>>>>>[-]]<<<<<<<<<<<<<<<[-]+<<<<[>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<-]>>>>
+>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<->>>>>>>>
+>>>>>>>[-]]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[[-]<<<<<<<<<<<<<
+<<[>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>-]>[<<<<<<<<<<<<+>>>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]
+>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-]]
+<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>[
+<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>[-]>>>>>>>>
+>>>[-]<<<<<<<<<<<<[>+>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>
+>>>>>-]<<<<<<<<<<<+[>>>>>>>>>>>+<<<<<<<<<<<[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>
+>>>-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>
+>-]<<<<[>>[-]+[<<<<<<<<<<<+>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<+>>>>>>>>>>-]<<<<
+<<<<<[-]>>>>>>[<<<<<<+>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<<<<<<<[>>>>>>>>
+>>>+<<<<<<<<<<<[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>+>>>
+>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>[-]+[<<<<->>>>-]<<[-]
+]>>[-]+[<<<->>>-]<<<<<<<<<[-]>>>>>>[<<<<<<+>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-
+]>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>
+>>>[-]]<<<<<<<[>>>>>>>+<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>[<<<<<<<<<<<<[-]->>>>>>>
+>>>>>[-]]<<<<<<<<<<<<[>>>>>>>>>>>+<<<<<<<<<<<[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>
+>>>>>-]<<<<<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>
+-]<<<<[<<<<<<<[-]>>>>>>>>>>>[-]<<<<<<<<<<<<<<<[>>>>+>>>>>>>>>>>+<<<<<<<<<<<<<<<-
+]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<+[>>>>>>>>>>>+<<<<<
+<<<<<<[-]]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<
+<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<[-]<<<<<<<<<<<<<<<<<<[>>>>
+>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<[-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>
+>>>>>+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<]>>>>[-]<<<<<<<<<[-]<<<<<<<<<<<<<<[>>>>>>
+>>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<[-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<[-]<<<[-]>>>>>>>>>[<<<<<<+>>>>>>>>>>
+>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<<[<<<<<<<<+>>>>>>>>>>>>>>+<<<<<<-]>>>>>>[<<<<<<
++>>>>>>-]<<<<<<<<[-]+[>[-]>>>>>>>[-]<<<<<[<<+>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<
+<<<<<<[>>>>>>>+<<<<<<<[-]]+>>>>>>>[<<<<<<<->>>>>>>-]<<<<[-]<<<[>>>+>>>>+<<<<<<<-
+]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<[>>[-]+[<<<<->>>>-]<<[-]]>>[-]+[<<<->>>-]<<<<<[-]<
+<[>>+>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<[>>>>>>>+<<<<<<<[-
+]]+>>>>>>>[<<<<<<<->>>>>>>-]<<<<<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<
+<<<[>>[-]+[<<<<<<<<->>>>>>>>-]<<[-]]>>[-]+[<<<<<<<->>>>>>>-]<<<<<<[-]>>>[<<<+>>>
+>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<
+<<<<<<->>>>>>>>>[-]]<<<<<<<[>>>>>>>+<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>[<<<<<<<<<[
+-]->>>>>>>>>[-]]<<<<<<<<<]>>>>>>>>[-]<<<<<[-]<<<<<<[>>>>>>+>>>>>+<<<<<<<<<<<-]>>
+>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<[-]<<<<<<<<[>>>>>>>>+>>>>>>+<<<<<<<<<<<
+<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>
+>[-]<[>+>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]>[-]<<
+<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]+<<<<<<[>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<
+<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<->>>>
+>>>>>>>>[-]]<<<<<<<<<<<<<<<[-]>[<+>>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<
+<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]+<<<<
+[>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<[>>>>>>>>>
+>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<+<<<<<<<<<<<<
+<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<+>>>>>>>>>>>>[-]
+]]<[-]<<<<[-]<<<<<<<[>>>>>>>+>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>
+>>-]<<<<[<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>
+>>>>>>-]<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>[<
+<<<<<<<+>>>>>>>>>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<<<<
+<<<<<<[-]>>>>>>>>[<<<<<<<<+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+
+>>>>>>>>>>-]<<<<<[-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+-]<<<<<<[-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<
+-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<
+<[-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>
+>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<[->>>>>>>>>>>>>>+>+<<
+<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>
+>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>
+>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[-
+>>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<[-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<
+<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<[->>>>>>>>>>>
+>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->
++<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]+[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>-]<<<<<<<<<<<<<<<[-]<[-]>>>[-]<[-]>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>[
+<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]
+<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>[-]>>>>>>>>>>>>>[-]<<<<<<<<<<<<<+<<<<<<<<[>>>
+>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<->>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[-]+<<
+<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>
+>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<
+<<->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[[-
+]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>
+>>>>>>>>>-]>[<<<<<<<<<<<<<+>>>>>>>>>>>>>[-]]]<[-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<
+<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<[-]+
+>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<[-]<<<<<<<<<[>>>>>>>>>>[-]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<[>>>+>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<
+<<<<<<+[>>>>>>>>>>>>+<<<<<<<<<<<<[-]]+>>>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>>>>-]<<
+<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>
+-]<<<<[>>[-]+[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<<<+>>>>>>>>
+>>>>>-]<<<<<<<<<<[-]>>>>>>>[<<<<<<<+>>>>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<<
+<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<[-]]+>>>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>>>>-]<<
+<<<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<
+<<<[>>[-]+[<<<<->>>>-]<<[-]]>>[-]+[<<<->>>-]<<<<<<<<<<[-]<[-]>>>>[-]>>>>[<<<<+>>
+>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]>[-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+>>>>>>>
+>>>[<<<<<<<<<<->>>>>>>>>>[-]]<<<<<<<<<<<[-]>>>>[<<<<+>>>>>>>>>>+<<<<<<-]>>>>>>[<
+<<<<<+>>>>>>-]<<<<<<<<<<[>>>>>>>>>>>+<<<<<<<<<<<-]+>>>>>>>>>>>[<<<<<<<<<<<->>>>>
+>>>>>>[-]]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[[-]<<<<<<<<<<<[>>>>>>>>>>
+>+<+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>[<<<<<<<<<<+>>>>>>>>>>[-]]]<[
+-]<<<<<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<<<<<<<<[
+-]+>>>>>>>>>[-]]<<<<<<<<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<
+<<<+>>>>>>>>>>>>>-]<<<<[<<<<<<<<[-]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<[>>>>>+>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<+[>>>>>>>>>>>>+<<<<<<<<<<<<[-]]+>>>>>>>>>>>>[<<<<<<<<<<<<->>>>>>>>>
+>>>-]<<<<[-]<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>
+>>>>>>>-]<<<<[>>[-]+[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<[-]]>>[-]+[<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>-]<<<[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+>>>>>+<<
+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>
++>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<]<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>[-
+]>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<[>>>+>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>
+>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]+<<
+<<<<<<[>>>>>>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<->>>>>>>>>>>>>[-]]<<<<<<<<<<
+[-]<<<<<<<[>>>>>>>+>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>>>-]<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+<<<<<<<<<<<<<<<<[>>>>>>>>>>
+>>>>>>>>>>>>>>>>-<+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<
+<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<->>>>>>>>>>[-]]<<<<<<<<
+<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[[-]<<<<<<<<<<[>>>>>>>>>>+<+<<<<
+<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]>[<<<<<<<<<<<<<+>>>>>>>>>>>>>[-]]]<[-]<<<<
+<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<
+<[<<<<<<<<<<<<<<<<<<[-]+>>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<
+->>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>>[-]<<<<<<<
+<<<<<<<<<<<<<[-]>>>[<<<+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>
+>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>[<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+>
+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>
+>>>>>>>+>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>
+>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>+<+<<<
+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]->>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<]>>>>>>>>>>[-]>>>>>>>>>>>>>>>>>>>>
+[-]<<<<<<<<<<<<<<<<<<<<<[>+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>
+>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[
+-]>[>>>>>>>>>>>>>>>>>>[-]+[<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>-]>>[-]<[-]<<<<<
+<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>[
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>
+>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]
+>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-
+<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>
+>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<
+<<<<<[-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<-]>>[<<+
+>>-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>
+>>+>+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>-]<[>>+<<-]>+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[
+-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<<<
+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>>>>>>>[-]++++++++++.<<<<<[-]]>>>>[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[-]<<[>>+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<---------------------------------------------------------------------------
+-----------------------------[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>-]<<<<[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>[-]]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<----------[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<[-]]+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<]<]
\ No newline at end of file
@@ -1,46 +1,34 @@
->>>>>>>>>>>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+++++.+++++++++++++++++++++++++++++++++++++++++.++++++.---------------.+++++++++
-++++.---------------------------------------------------------------------------
--------.+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.------
------------------------------------------------------------.++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.+++++++.--------.----
--------.+++.+++++++++++++.------------------------------------------------------
---.--------------------------.<<<<<<<<<<<<<[-]>>[-]+>[-]<[>>,>>>>>>>>>[-]<<<[-]<
-<<<<<<[>>>>>>>+>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<[->>>>>>>>>>
->>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->
->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[>>>
-[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>
->>+<<<<]>>-]<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>
->>>>>]<<<<<<<<<<<<<[-]<<<<[-]<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>
->>>>>>-]<<<<[->>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<
-<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>+<<<<<<<<<<<<<<]>>>>>>>>>>>>>[-<<
-<<<<<<<<<<<+>>>>>>>>>>>>>]<<<<<<<<<<<<<[->>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<]>>>>>>
->>>>>>>[-<<<<<<<<<<<<<+>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>
->[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>[-]<<<<<<
-<<<<<[-]>>[<<+>>>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<[-]+++++++
-+++>>[-]>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]+>>>>>>>>>[>>>-<+<<-]>>[<<+>
->-]>[<<<<<<<<<<<<->>>>>>>>>>>>[-]]<[-]<<<<<<<<<<<[>>>>>>>>>>>+<<<<<<<<<<<[-]]+>>
->>>>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<]>>>>>>>>>>>[-]<<<<<<<<<<<<[-]>>[<
-<+>>>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<<<<<<<<->>>[-]
-<<<[->>>>>>>>>>>>[-]<[-]<<<<<<<<<<<[>>>>>>>>>>>+>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<
-<<<<<<<<<+>>>>>>>>>>>>-]<[->>>>>>>>>>>+>+<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>
->>>>>>>>>>]<<<<<<<<<<<[->>>>>>>>>>>+>>+<<<<<<<<<<<<<]>>>>>>>>>>>[-<<<<<<<<<<<+>>
->>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]
->[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>
->>>>>>>>>>>>]<<<<<<<<<<<<<[-]<<<<<<<<[-]>>>>>>[<<<<<<+>>>>>>>>+<<-]>>[<<+>>-]<<<
-<<<<<------------------------------------------------>>>>>>>>[-]<<<<[-]<<<<<[>>>
->>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[<<<[-]+>>>>>>>[-]<<<<<<[-
-]<<<[>>>+>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<[->>>>[-]+++++++
-+++>>[-]>[-]<<<<<<<<[>>>>>>>>+<<<<<<<<-]>>>>>>>>[<<<[<<<<<+>>>>>>>+<<-]>>[<<+>>-
-]>-]<<<<<<<]>>>>>>[-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<[<+>>>
->>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]>-]<<<<<[-]]>>>>[-]<<<<<<<<[<<<<<+>>>>>>
->>>>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<<+<<<]>>>>>>>>>>>>[-]+++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-++++.++++++++++++++++++++++.++++++.---------------------------------------------
-----------------------------------------.+++++++++++++++++++++++++++++++++++++++
-++++++++++++++++++++++++++++++.+++++++++.++++++.---------------.+++++++++++++.--
------------.-.------------------------------------------.-----------------------
----.[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>+>+<<<<<<<<
-<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<[>>+>+<<<-]>>>[<<<+>>>-]<
-<+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>
--]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<[-]++++++++++.
+>>>>>>>>>>++++++++++++++++[>++>++++>++++++>+++++++>+++++++<<<<<-]>>+++++.>>--.>+
++++.<<+++++.>>--.<<<<.>>----.<<.>>>.>+++.<-.<+.+++.>>---.<<<-----------.<.<<<<<<
+<<+[>,>>>>>>[-]<<<[-]<<<<<[>>>>>+>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<[-
+>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<
+<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
++>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[
+[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<[-]<<[>>+>>>>+<<<<<<-]>>>>>>
+[<<<<<<+>>>>>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<
+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<
+[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-
+]+[<<<<<<+>>>>>>-]>>[-]<<<<<<<[-]>[<+>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<
+<<----------[>>>>>>>+<<<<<<<[-]]+>>>>>>>[<<<<<<<->>>>>>>-]<<<<<<<[>>>>>>>+<<<<<<
+<[-]]+>>>>>>>[<<<<<<<->>>>>>>-]<<<<<<<]>>>>>>>[-]<<<<<<<<<[-]>[<+>>>>>>>>>+<<<<<
+<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<[-]+[<<<<<<<->>>>>>>-]<<<<<<[-]<[>>>>>>>[-]+[
+<<<<<<<->>>>>>>-]>>[-]<[-]<<<<<<<<[>>>>>>>>+>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>
+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]
+<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>
+>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+
+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<[-]>>>>>>[<<<<<<+>>>>>>>>+<<-]>>[<<+>>-]<<[
+-]>>++++++[<<++++++++>>-]<<[<<<<<<->>>>>>-]<<[-]<<<[>>>+>>>>+<<<<<<<-]>>>>>>>[<<
+<<<<<+>>>>>>>-]<<<<[<<[-]+>[-]>>>>>[-]<<<<<<<[>>+>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+
+>>>>>>>-]<<<<<[>>>[-]+[<<<->>>-]>>[-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>[<<<<<<++++++++
+++>>>>>>-]<<<<<]>>>>>[-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<[<<+
+>>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>-]<<<<<[-]]>>>>[-]<<<<<<<<[<<+>>>>>>>>>>
++<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<[-]+[<<<<<+>>>>>-]<<<<<<<]>>>>>>>>>>[-]
+>[-]>[-]>[-]<<<<[-]++++++++++++++++[>++>++++>++++++>+++++++<<<<-]>>>-------.>-.+
++++++.<<<.>>++++++++++++.>-------.++++++.<.>--.<.-.<------.<.[-]>[-]>[-]>[-]>[-]
+>[-]>[-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>+>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>
+>>>>>>>-]<[>>+<<-]>+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++
+[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]++++++++++.
\ No newline at end of file
@@ -0,0 +1,41 @@
+>>>>>>>+++++++++++++++[>>>>>>>>>>>>>>>+++>+++>+++>+++>+++>+++>+++>+++>+++>+++>++
++>+++<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>+>+>+>+>+>+>+>+>+>+>+>+<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++[>>[-]>>>>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>
+>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>
+>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<
+<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[
+-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<[-]>>>[<<<+>>>>>+<<-]>>[<<+>>-]<<<<<
+.>>>[-]+[<<<<+>>>>-]+[<<<<<->>>>>-]<<<<<]>>>>>>>>[-]++++++++++.>>>>>>>>>>>>>>>>[
+-]>[-]>[-]<<<<<<<<<<<<<<<<<<<[-]++++++++++++++[>>>>>>>>>>>>>>>>>+++++++>+++++++>
+++++++++<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>++++>--->>[-]>[-]>[-]>[-]<<<<<<<<
+<<<<<<<<<<<<<<<<+++++++++++++++[>>>>>>>>>>>>>>>>>>>>>++++>++++>++++>++++<<<<<<<<
+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>+>+>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<
+++++++++++++[>>[-]>>>>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>
+>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[-
+>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<
+<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<
+<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<
+<<<<<<<<<<<<[-]<<<<<[-]>>>[<<<+>>>>>+<<-]>>[<<+>>-]<<<<<.>>>[-]+[<<<<+>>>>-]+[<<
+<<<->>>>>-]<<<<<]>>>>>>>>[-]++++++++++.>>>>>>>>>>>>>>[-]>[-]>[-]>[-]<<<<<<<<<<<<
+<<<<<<[-]+++++++++++++++[>>>>>>>>>>>>>>>+++++++>+++++++>+++++++>+++++++<<<<<<<<<
+<<<<<<<<<-]>>>>>>>>>>>>>>>--->>+++>+++>[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<
+<<<<<<<<<<<<<<<<++++++++++++++++[>>>>>>>>>>>>>>>>>>>++>++>++>++>++>++>++>++<<<<<
+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[-]<++++++++++++[>>[-]>>>>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]
+<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<
+<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>
+>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[-
+>>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>]<<<<<<<<<<<<<<[-]<<<<<[-]>>>[<<<+>>>>>+<<-]>>[<<+>>-]<<<<<.>>>[-]+[<<<<+>>>>
+-]+[<<<<<->>>>>-]<<<<<]>>>>>>>>[-]++++++++++.>>>>>>>>>>>>>>[-]>[-]>[-]>[-]>[-]>[
+-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<[-]+++++++++++++++[>>>>>>>>>
+>>>>>>+++>+++>+++>+++>+++>+++>+++>+++>+++>+++>+++>+++<<<<<<<<<<<<<<<<<<<<<<<<<<-
+]>>>>>>>>>>>>>>>+>+>+>+>+>+>+>+>+>+>+>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]<+++++
++++++++[>>[-]>>>>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>
+>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>
+>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>
+>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>
+>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<[-]<<<<<[-]>>>[<<<+>>>>>+<<-]>>[<<+>>-]<<<<<.>>>[-]+[<<<<+>>>>-]+[<<<<<->
+>>>>-]<<<<<]>>>>>>>>[-]++++++++++.
\ No newline at end of file
@@ -1,21 +1,17 @@
-[-]+>[-]+<[>>[-]+>>>>>>[-]<<<<<[-]<<[>>+>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]
-<<[-]+++>>>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<[>>>>>>+<<<<<<-]>>>[>>>>+>+<<<<<-]>
->>>>[<<<<<+>>>>>-]<<[>->+<[>]>[<+>-]<<[<]>-]>>[<<<<<<<<+>>>>>>>>-]<<<[-]<<<<<[>>
->>>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[
->>>>[-]++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++.++
-+++++++++++++++++++++++++++++++++.+++++++++++++++++..<<<<<<[-]>>[-]]>>>>[-]<<<<<
-[-]<<[>>+>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<[-]+++++>>>[-]>[-]>[-]>[-]>[-
-]>[-]<<<<<<<<<<<[>>>>>>+<<<<<<-]>>>[>>>>+>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<[>->+<[>]
->[<+>-]<<[<]>-]>>[<<<<<<<<+>>>>>>>>-]<<<[-]<<<<<[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>
->>-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>[-]++++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++.+++++++++++++++++++++++++++++++++++
-++++++++++++++++.+++++..<<<<<<[-]>>[-]]>>>>[-]<<<<[-]<<[>>+>>>>+<<<<<<-]>>>>>>[<
-<<<<<+>>>>>>-]<<<<[>>>>[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<[>>>>>>>+>+<
-<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<[>>+>+<<<-]>>>[<<<+>>>-]<<+>[<->[>++++++++
-++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<
-[->>++++++++[<++++++>-]]<[.[-]<]<<<<<[-]]>>>>[-]++++++++++.<<<<<<<+>>>>>>>[-]<<<
-<<<<<[-]>[<+>>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<[-]++++++++++++++++++++
-++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-+>>[-]>[-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]+>>>>>>[>>>-<+<<-]>>[<<+>>-]>[<<<<<<<<<
-->>>>>>>>>[-]]<[-]<<<<<<<<[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<
-<<<<<]
\ No newline at end of file
++>+<[>>[-]+>[-]>>>>>[-]<<<<<<<[>>+>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]>[-]++
++>[-]>[-]>[-]>[-]<<<<<<<<<<[>>>>>+<<<<<-]>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]
+>>[-]<[<<<<<<<+>>>>>>>-]<<<<<<<[>>>>>+<<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<[-]<[>+>>
+>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>>[-]>[-]>[-]<<<[-]+++++++++++++++[>+++++>+
+++++++>++++++++<<<-]>-----.>.>++..<<<<<<<<<[-]>>[-]]>>>>[-]<<<<<[-]<<[>>+>>>>>+<
+<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]>[-]+++++>[-]>[-]>[-]>[-]<<<<<<<<<<[>>>>>+<<<<<
+-]>>>>>[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[-]<[<<<<<<<+>>>>>>>-]<<<<<<<[>>>>>+<
+<<<<[-]]+>>>>>[<<<<<->>>>>-]<<<<[-]<[>+>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]<<<<[>>>>>
+[-]>[-]<<[-]+++++++++++++[>+++++>+++++++++<<-]>+.>.+++++..<<<<<<<<[-]>>[-]]>>>>[
+-]<<<<<<[>>+>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<[>>>>[-]>[-]>[-]>[-]>[-]>[-]>
+[-]>[-]<<<<<<<<<<<<<<[>>>>>>>+>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<[>>+<<-]>
++>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-
+]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<<<<<[-]]>>>>>[-]++++++++++.<<<[
+-]+[<<<<<+>>>>>-]>>[-]<<<<<<<<[-]>[<+>>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]
+<<<<<<<<------------------------------------------------------------------------
+-----------------------------[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]
+<<<<<<<<[>>>>>>>>+<<<<<<<<[-]]+>>>>>>>>[<<<<<<<<->>>>>>>>-]<<<<<<<<]
\ No newline at end of file
@@ -0,0 +1,17 @@
+>>>+++[>>>[-]+[<<<<<+>>>>>-]>>[-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<[>>>>
+>>>+>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<[>>+<<-]>+>[<->[>++++++++++<[->-[>+
+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++
+++[<++++++>-]]<[.[-]<]<[-]++++[>++++++++<-]>.<<<<<<<[-]>[<+>>>>>>+<<<<<-]>>>>>[<
+<<<<+>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>[<<<<<<++>>>>>>-]>[-]>[-]>[-]>[-]>[-]>[-
+]>[-]<<<<<<<<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[>>+<<-]>+>[<->[>
+++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>>
+-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]++++++++++.<<<[-]+[<<<->>>-]<<<]+++<<[-]
+>[-]>[>>>[-]+[<<<<<+>>>>>-]>>[-]<<<<<<<[>+>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>
+>-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>
+>>>>>>-]<[>>+<<-]>+>[<->[>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[
+<++++++>-]>[<<+>>-]>[<<+>>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]<[-]++++[>++++
+++++<-]>.<<<<<<<<<[-]>[<+>>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<<<<<<<<[>>>
+>>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+++>>>>>>>>-]>[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<
+<<<<<<<<<[>>>>>>>>+>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<[>>+<<-]>+>[<->[
+>++++++++++<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]++++++++[<++++++>-]>[<<+>>-]>[<<+>
+>-]<<]>]<[->>++++++++[<++++++>-]]<[.[-]<]++++++++++.<<<[-]+[<<<->>>-]<<<]
\ No newline at end of file
@@ -0,0 +1,175 @@
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++>>++++++++[<+++++++++++++>-]<->++++>>++++++
+++++[<++++++++++>-]+++>>++++++++++[<++++++++++>-]<+>>++++++++++[<++++++++++>-]<+
++>++++>>++++++++++[<++++++++++>-]<+>++++>>++++++++++[<++++++++++>-]++>>++++++[<+
+++++++++++>-]>++++++++++[<++++++++++>-]<+>+++++>>++++++++[<++++++++>-]++++>>++++
+++++++[<++++++++++>-]++++++>>++++++++++[<++++++++++>-]<+>>++++++++++[<++++++++++
+>-]<++>++++>>++++++++++[<++++++++++>-]<+>++++>>++++++++++[<++++++++++>-]+>>++++[
+<+++++++>-]+++++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+++++++++++++++[>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++>+++
+>+++>+++>+++>+++>+++>+++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>++++++++++>>+
++++++++[<++++++++>-]<+>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<++++++++++++++++[>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+++++++>++++++>+++++++>+++++++>+++++++>++>+
+++++++>+++++++>+++++++>+++++++>++++++>++<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-------->+++++>---->---->->>+++
+++++>->++>---->++++>+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<+[>[-]>[-]+>[-]++>[-]+++>[-]++++>>[-]+++++>[-]++++++>>>>>>>>>[-]<[-]<<<<<
+<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>
+>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<
+<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>
+[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>
+>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<<<<[-]
+>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>+<<-]>>[<<+>>-]>[-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<-]+>>>>>[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<
+<<<+>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<<[>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]+>>>>[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<
+<<<<<<<+>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<<[>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<-]+>>>[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<
+<<<<<+>>>>>>>>>>>-]>[<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<<[>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<-]+>>[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>
+>>>>>>>>>-]>[<<<<<<<<<<<<<<->>>>>>>>>>>>>>[-]]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<
+<<<<<<<-]+>[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>[<
+<<<<<<<<<<<<->>>>>>>>>>>>>[-]]<<<<<<<<<<<[>>>>>>>>>>>+<<<<<<<<<<<-]+<[>>>>>>>>>>
+>>-<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>[<<<<<<<<<<<->>>>>>>>>>>
+[-]]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]+<<[>>>>>>>>>>>>-<+<<<<<<<<<<<-]>>>>>>>>>>
+>[<<<<<<<<<<<+>>>>>>>>>>>-]>[<<<<<<<<<<->>>>>>>>>>[-]]<<<<<[-]<<<<<<<<<<<<[>>>>>
+>>>>>>>+>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>-]<<<<[>>>>>[-]>[-]>[-]<<<[-]+++++++++++[>+>++++++>++++++++<<<-]>>+++.>.----.<<
+-.<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>[-]]>>>>[-]<<<<<<<<<<<<<<<[>>>>>>>>>>>+>>>>+
+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<[>>>>>[-]>
+[-]<<[-]+++++[>++>+++++++++++++++<<-]>>-.+++.+++.<.<<<[-]+[<<<<<+>>>>>-]<<<<[-]<
+[>+>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<
+<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>
+>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>
+>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>
+[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<[-]>>>>>[<<<<<+>>>>>>>+<<-]>>[<<+>>-]<<[
+-]+[<<<<<->>>>>-]<<[-]]>>>>[-]<<<<<<<<<<<<<<[>>>>>>>>>>+>>>>+<<<<<<<<<<<<<<-]>>>
+>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<[>>>>>[-]>[-]<<[-]+++++++++++[>+>
++++++++<<-]>>.++.+++++++.<-.<<<[-]++[<<<<<+>>>>>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]>
+>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<
+<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<
+<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<
+<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<<
++>>-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<
+<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<
+<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+
+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<
+<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<
+<<[-]>>>>>>[<<<<<<+>>>>>>>>+<<-]>>[<<+>>-]<<[-]+[<<<<<->>>>>-]>[-]<<<<<<[>>>>>>+
+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>
+[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>
+>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>
+>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>
+>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>
+>>+<<-]>>[<<+>>-]<<<[-]<<<[>>>+>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<[->>>>>>>>>>
+>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<
+<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<
++>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<[-]<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<
+<<<<<<<+>>>>>>>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<
+]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>
++<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>
+]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<
+[-]+[<<<<<+>>>>>-]<<[-]]>>>>[-]<<<<<<<<<<<<<[>>>>>>>>>+>>>>+<<<<<<<<<<<<<-]>>>>>
+>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<[>>>>>[-]>[-]<<[-]+++++++++++[>+>+++++
++<<-]>>-.+++..<-.<<<[-]++[<<<<<+>>>>>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<
+<<<+>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>
+>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>
+>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]
+>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<<+>>-]<[-]<<
+<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>
+>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>
+>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<
++<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>
+>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<[-]>>>>>>
+[<<<<<<+>>>>>>>>+<<-]>>[<<+>>-]<<[-]+[<<<<<->>>>>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]
+>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<
+<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<
+<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+
+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<
+<+>>-]<<<[-]<<<[>>>+>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<[->>>>>>>>>>>>>>+>+<<<<
+<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>
+>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>
+[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>
+>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<[>>>>+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>
+>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>
+>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<
+<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<
+]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]+[<<<<<+>>>
+>>-]<<[-]]>>>>[-]<<<<<<<<<<<<[>>>>>>>>+>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<
+<<<+>>>>>>>>>>>>-]<<<<[>>>>>[-]>[-]<<[-]++++++++++[>+>++++++++<<-]>>.++.++.<.<<<
+[-]+[<<<<<+>>>>>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>
+>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>
+>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<
++>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<
+<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<
+<<<<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<[>>>>>+>+<<<<<<-]>
+>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+
+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<
+<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]
+>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<
+<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<[-]>>>>>>[<<<<<<+>>>>>>>>+<<-]
+>>[<<+>>-]<<<<<<<<.>>>>[-]]>>>>[-]<<<<<<<<<<[>>>>>>+>>>>+<<<<<<<<<<-]>>>>>>>>>>[
+<<<<<<<<<<+>>>>>>>>>>-]<<<<[>>>>>[-]>[-]<<[-]++++++++++[>+>++++++++<<-]>>.++.++.
+-.<.<<<[-]+[<<<<<+>>>>>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<
+[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<
+<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>
+>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->
+>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>]<<<<<<<<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<[>>>>>+>+<<
+<<<<-]>>>>>>[<<<<<<+>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<
+<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<
+<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->
+>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<[-]>>>[<<<+>>>>>+<<-]>>[<<
++>>-]<<<<<[.>>>[-]+[<<<<+>>>>-]>>[-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>>>
+>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<
+<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>
+]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<
+<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<[-]>>>[<<<+>>>>>+<<-]>>[<<+>>-]<<<<<]>[-]]>>>>[-]<
+<<<<<<<<[>>>>>+>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<[>>>>>[-]>[-]<
+<[-]+++++++++[>+>+++++++++<<-]>>++.++.-------------------.<+.<<<[-]++[<<<<<+>>>>
+>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>>>>>+>+<<<<<
+<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>>>>>>>>+>>+<
+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<
+[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<
+<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<
+<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<<+>>-]<[-]<<<<<[>>>>>+>+<<<<<<-]>>>>>>[<<<<<<+>>
+>>>>-]<[->>>>>>>>>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<
+<<<<<<<<<<[->>>>>>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>
+>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]
+<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<[-]>>>>>>[<<<<<<+>>>>>>>>+<<-]>>[<<+>>-]<<[-]
++[<<<<<->>>>>-]>[-]<<<<<<[>>>>>>+>+<<<<<<<-]>>>>>>>[<<<<<<<+>>>>>>>-]<[->>>>>>>>
+>>>>+>+<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]<<<<<<<<<<<<[->>>>>
+>>>>>>>+>>+<<<<<<<<<<<<<<]>>>>>>>>>>>>[-<<<<<<<<<<<<+>>>>>>>>>>>>]>[>>>[-<<<<+>>
+>>]<<[->+<]<[->+<]>-]>>>[-<+<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>
+>-]<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>]<<<<<<<
+<<<<<<<[-]<<<<<<[-]>>>>[<<<<+>>>>>>+<<-]>>[<<+>>-]<<<[-]<<<[>>>+>>>+<<<<<<-]>>>>
+>>[<<<<<<+>>>>>>-]<<<[->>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>
+>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<<[->+<]<[->+<]>-]>>>[-<
++<<+>>>]<<<[->>>+<<<]>[[-<+>]>[-<+>]<<<<[->>>>+<<<<]>>-]<<<<<<<<<<<<<<<<<[-]>>>>
+>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[-]<<<<<<<<[
+>>>>->>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<[->>>>>>>>>>>>>>>+>>>+<<<<<<
+<<<<<<<<<<<<]>>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>]<<<<<<<<<<<<<<[->>
+>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>>>>>>>>>>>>>>]<<<
+<<<<<<<<<<<[->>>>>>>>>>>>>>+>>+<<<<<<<<<<<<<<<<]>>>>>>>>>>>>>>[-<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>]>[>>>[-<<<<+>>>>]<[->+<]<[->+<]<[->+<]>-]>>>[-]<[->+<]<[[-<+>]<<<[
+->>>>+<<<<]>>-]<<<<<<<<<<<<<<<[-]+[<<<<<+>>>>>-]<<[-]]>>[-]+[<<<<<+>>>>>-]<<<<<<
+<<<<<<<<<]
\ No newline at end of file
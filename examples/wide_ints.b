@@ -0,0 +1,785 @@
+>>>>>>>>>>>>>>>>>->-<<+++++++[<-------->-]<[>>>>>>>>+>>>>>+<<<<<<<<<<<<<-]>>>>>>
+>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>>+<<[->
++[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[<<<<<<<+>>>
+>>>>-]>->>[>>+<<-]<<<<<<<<<<<[>>>>>>>+>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<
+<<<+>>>>>>>>>>>>-]<<<<<[<<<<<+>>>>>-]>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<<
+<[>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>>>>>>+<<<
+<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>
++<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<
+<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-
+]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<
+<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-
+]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<
+<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>
+>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<
+<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>
+>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<
++<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>
+>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++++++++++++++++++++++++++++
+++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>
+>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>
+>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<
+<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>
++<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>++++++++++++++++++++++++++
+++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]
+<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<
+[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++
+.<<<<<<<<[-]]>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<
+<<<<<<<[-]<<<<<[-]++++++++++.<<<<<<<[-]>>>>>>++++[<<<<<<+++++++++++>>>>>>-]<<<<<
+[-]+<<<[-]++++++++++++>[-]<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<+<<<<<<<<-]>>>>>>>>
+[<<<<<<<<+>>>>>>>>-]>>>>>>>>>>>>>>>++++[>++++<-]>[<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-
+]>[-]>[-]>[-]>>[<<<<<<<<+>>>>>+>>>-]<<<[>>>+<<<-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[
+->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<
+<<<<<<-]>->>[>>+<<-]>>>>>[<<<<<<<<<+>>>>>+>>>>-]<<<<[>>>>+<<<<-]<<<<<[>>>>>>>>>+
+<<<<<<<<<-]>>>>>>[>>>+<<<-]<<<<[-]>[-]>>>>>>>>>[<<<<<<<<<<<<+>>>>>+>>>>>>>-]<<<<
+<<<[>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<+<<[->+[>-]>[->>
++<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>+<<<<<<<<<
+<<-]>->>[>>+<<-]>>>>>>>>>[<<<<<<<<<<<<<+>>>>>+>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<
+<<-]>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>
+>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>+<<<<<<<<<<<<-]>->>[>>
+>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[
+-]>[-]<<<<<<<<<<<<[>>>>>>+>>>>>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>
+-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<
+<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]<<<<<<<<<[>>>>>+>>>>>+<<<<<
+<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>[>>>+<
+<<-]>>>>>>>>>>>]<-]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<
+<[-]<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>
+>>>>>+<<<<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<
+[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>
+>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<
+<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>
+-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]
+<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>
+>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<
+<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]
+<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<
+<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>
+>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+
+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++++++++++++++++++++++++
++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<
+<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>
+>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-
+]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-
+]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>+++++++++++++++++
++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>
+>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>
+>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++++++++++++++++++++++++++++++++++++++
++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++
+++.[-]<<<<<<<<<<[-]<<<<<[-]++++++++++.<<<<<<<[-]+++++>[-]<<<[-]+++++++>[-]>>>>>>
+>>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<[>>>>>>>>+>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<
+<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>>+<<[->[>-]>[->>
++<]<+<-<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->[>-]>[->>+<]<+<-<]>[<<<<<<<+>>>>>>>-]>->
+>[>>+<<-]<<<<<<<<<<<[>>>>>>>+>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>
+>>>>>>>-]<<<<<[<<<<<->>>>>-]>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>
+>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<+<<
+<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<
+<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[
+>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>
+>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<+++++
++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>
+>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[
+>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>++
++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<+++++++
++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<
+<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>
+>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<
+<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++++++++++++++++++++++++++++++++++++++++++
++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<
+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++
++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<
++>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+
+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>+++++++++++++++++++++++++++++++++++
++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<
+<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<
+[-]]>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<[-
+]<<<<<[-]++++++++++.<<<<<<<<<<<<<<<[-]>[-]<+++++[>++++++++<-]>>[-]<<+++++++++[>>
+++++++++++++<<-]>>->[-]------------------<<<<<<<<[-]+++++++++++++++++++++>[-]---
+------------------------------------------------>[-]>>>+++++++[<<<+++++++++++++>
+>>-]<<[-]+++++++>>>>>>>>>>>>>>>>>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<[>>>
+>>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<
+<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<
+<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]>->>
+[>>+<<-]<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<<<<<<<-
+]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<
+<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>+<<[->+[>-]>[->>+<]<+
+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>-]>->>[>>+<<-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<
+<<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>>+<<[->+[>-]>[->>+<]<+<
+<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[<<<<<<<<<<<<<+>>>>>>>>>>>>>
+-]>->>[>>+<<-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<<<<<-
+]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<[<<<<<<
+<<<<<+>>>>>>>>>>>-]>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<
+<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<<-]
+>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>
+>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-
+]>>>>>>>[-]++++++++++[>>>>>>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+
+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>>>[<<<<<<<<<<<
++>>>>>>>>>>>-]<<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-
+]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>>+++++++++++++++++++++++++>++++++<<<<<<]>>>>
+>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>
+>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[
+-]>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>
+>>>>>+<<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>+++++++++++++++++++++++++>>+++
++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]
+<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>>>+<<<<-]<++++++
+++++>>>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>
+[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++
+>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>
+>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++
+++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>
+[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>
+>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>
+>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>
+>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[
+>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>
+>[>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<
+<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<
+<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++++++++++++++++++++++++++++
++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<
+<<-]>>>>>>>[>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>
+>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++
++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>[<<<<<<<<<
+<+<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>
+>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>+++++++++++++++++
++++++++++++++++++++++++++++++++.<<<<<<<<<[-]]>>>>>>>>>[-]>[<<<<<<<<<<<+<<<<<<+>>
+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>[>
++<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>+++++++++++++++++++++++
++++++++++++++++++++++++++.<<<<<<<<<<[-]]>>>>>>>>>>[-]>[<<<<<<<<<<<<+<<<<<<+>>>>>
+>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>[
+>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>+++++++++++++++++++++
++++++++++++++++++++++++++++.<<<<<<<<<<<[-]]>>>>>>>>>>>[-]>[<<<<<<<<<<<<<+<<<<<<+
+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>+++++++++++
++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<[-]]>>>>>>>>>>>>[-]>[<<<<<<<<<
+<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>+<<<
+<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>
+>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<[-]]>>>>>>>
+>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<<<[-]
+<<<<<[-]++++++++++.[-]<-[>--<-----]>++++++<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>[<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<----[>---<--]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<[-]+>[-]>>>>>>>>>>>>>>>>>>>>>>>>++++++++[<
+++++++++++>-]>++++++[<---------->-]<->>++++[>++++++++<-]>[<<<<<<<<<<<<<<<<[-]>[-
+]>[-]>[-]>[-]>[-]>[-]>>[<<<<<<<<+>>>>>+>>>-]<<<[>>>+<<<-]>>>[<<<<<<<+>>>>>>>-]<<
+<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>
+>>>>>>+<<<<<<<-]>->>[>>+<<-]>>>>>[<<<<<<<<<+>>>>>+>>>>-]<<<<[>>>>+<<<<-]>>>>[<<<
+<<<<<+>>>>>>>>-]<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[
+>-]>[->>+<]<+<<]>[>>>>>>>>+<<<<<<<<-]>->>[>>+<<-]>>>>>>[<<<<<<<<<<+>>>>>+>>>>>-]
+<<<<<[>>>>>+<<<<<-]>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>
+>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>+<<<<<<<<<-]>->>[>>+<<
+-]>>>>>>>[<<<<<<<<<<<+>>>>>+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]<<<<<[>>>>>>>>>>>+<<<<
+<<<<<<<-]>>>>>>[>>>>>+<<<<<-]<<<<[-]>[-]>>>>>>>>>[<<<<<<<<<<<<+>>>>>+>>>>>>>-]<<
+<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<+<<[->+[>-]>[-
+>>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>+<<<<<<<
+<<<<-]>->>[>>+<<-]>>>>>>>>>[<<<<<<<<<<<<<+>>>>>+>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<
+<<<<-]>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>
+>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>+<<<<<<<<<<<<-]>->>[
+>>+<<-]>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-
+]>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>
+>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>->>
+[>>+<<-]>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>-]<<<<<<<<<<[>>>>>>>>>>+<<<<
+<<<<<<-]>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<+<<[->+[>-]>[->>+
+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<-]>->>[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<[-]>[
+-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<
+<<<-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]>>>[<<<<<<<+>>
+>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<
+]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>+>>>>>+<<<<<
+<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]>>>>[<<
+<<<<<<+>>>>>>>>-]<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+
+[>-]>[->>+<]<+<<]>[>>>>>>>>+<<<<<<<<-]>->>[>>+<<-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>+
+>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]
+>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-
+]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>+<<<<<<<<<-]>->>[>>+<<-]<<<<<<<<<<<<<<<[>
+>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>-]<<<<<[>>>>>>>>>>>+<<<<<<<<<<<-]>>>>>>[>>>>>+<<<<<-]>>>>>>>>>>>]<-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>
+>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<[-]<<<<<<<<
+<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<
+<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<[>
+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>
+>>-]>>>>>>>[-]++++++++++[>>>>>>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<
+[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>>>[<<<<<<<<
+<<<+>>>>>>>>>>>-]<<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<
+<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>>+++++++++++++++++++++++++>++++++<<<<<<]>
+>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[
+>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-
+]>[-]>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>
+[>>>>>>>+<<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>+++++++++++++++++++++++++>>
+++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>
+>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>>>+<<<<-]<+++
++++++++>>>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<
+<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>++++++++++++++++++++++
++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<
++>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]
+<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<
+<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++
+>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>
+>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>
+[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<
+<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>
+>>>>[>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<
+<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+
+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++
+++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<
+<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<
+<<<<<-]>>>>>>>[>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-
+]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>
+++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>[<<<<<<
+<<<<+<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>++++++++++++++
+++++++++++++++++++++++++++++++++++.<<<<<<<<<[-]]>>>>>>>>>[-]>[<<<<<<<<<<<+<<<<<<
++>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>
+>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>++++++++++++++++++++
+++++++++++++++++++++++++++++.<<<<<<<<<<[-]]>>>>>>>>>>[-]>[<<<<<<<<<<<<+<<<<<<+>>
+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>
+>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>++++++++++++++++++
+++++++++++++++++++++++++++++++.<<<<<<<<<<<[-]]>>>>>>>>>>>[-]>[<<<<<<<<<<<<<+<<<<
+<<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>++++++++
+++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<[-]]>>>>>>>>>>>>[-]>[<<<<<<
+<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>
+>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<[-]]>>>>
+>>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<<<
+[-]<<<<<[-]++++++++++.<<<<<<<<<<<<<<<<[-]+++++++++>[-]+>[-]>[-]>[-]>>>>>>>>>>>>[
+-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<<<<<<
+<-]>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<
+<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>+<<[->[>-]>[->>+<]<+<-<]
+>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->[>-]>[->>+<]<+<-<]>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>-]>->>[>>+<<-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
++>>>>[<<<<<<+>>>>>>-]<<<<<<[->[>-]>[->>+<]<+<-<]>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-
+]>->>[>>+<<-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>>+>>>>[<
+<<<<<+>>>>>>-]<<<<<<[->[>-]>[->>+<]<+<-<]>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]>->>[>>+
+<<-]>>[<<<<<<<<<<<<<<<<<->>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<
+<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<
+<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<+<<<<<<<<<
+<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>>>>>>>[-]++++++++
+++[>>>>>>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<<
+<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<
+<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>>>>>>>+<<<<<
+<<<<<-]>>>>[->>>>>+++++++++++++++++++++++++>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<
+<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<
+<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>>>[<<<<<<<<<<+
+>>>>>>>>>>-]<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>
+>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>+++++++++++++++++++++++++>>++++++<<<<<<]>>>>>>[<<
+<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+
+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>>[
+<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<
+-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>
+>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+
+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>
+>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]
+<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>
+>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>
+]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<
+<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<
+<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++
+++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>
+>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<
+[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<
+<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>
+++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<
+<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>
+>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++
+++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>[<<<<<<<<<<+<<<<<<+>>>>>>>>>>
+>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>
+>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>++++++++++++++++++++++++++++++++++++
+++++++++++++.<<<<<<<<<[-]]>>>>>>>>>[-]>[<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>-]<<
+<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<
+<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++
+++++++.<<<<<<<<<<[-]]>>>>>>>>>>[-]>[<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<
+<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++
+++++++++.<<<<<<<<<<<[-]]>>>>>>>>>>>[-]>[<<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>>
+-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+
+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>++++++++++++++++++++++++++++++
+++++++++++++++++++.<<<<<<<<<<<<[-]]>>>>>>>>>>>>[-]>[<<<<<<<<<<<<<<+<<<<<<+>>>>>>
+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-]
+>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>>++++++++++++
+++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>[-]>+++++++++
++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<<<[-]<<<<<[-]++++++++++.
+<<<<<<<<<<<[-]>>>>[<<<<+>>>>>>>>>>+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<[-]>>>
+>[<<<<+>>>>>>>>>+<<<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<-]>>>>>>>>>[<<
+<<<<<<<+>>>>>>>>>-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>
+>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>+>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<
+<<<<<<<<<+>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<
+<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>
+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>
+[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[
+-]<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<-]>>>>>
+>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>+>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<
+<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-
+]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<
++>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<
+<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>>>>>-]<[-]<<<<<<<<<<<<<<<<[-]<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<
+<<<<<+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<
+-]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<
+<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>
+>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<
+<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[
+-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<
+<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>
+>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<
+<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<
++>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]
+>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-
+]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++++++++++++++
++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<
+<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>
++<<<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-
+]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<
+<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>+++++++
++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<
+<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<
+<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++++++++++++++++++++++++++++
++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++
+++++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]<++++[>++++++++<-]>.<<<<<<<<<<<[-]>>[<<+>>>
+>>>>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<<[-]>>[<<+>>>>>>>>>+<<<<<<
+<-]>>>>>>>[<<<<<<<+>>>>>>>-]>>>>>>>>>>>>>>>>>[-]+>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<-]>>>>>>>>>[<<<<<<<
+<<+>>>>>>>>>-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>+>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<
+<<<<+>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>
+>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>
+>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]<<<
+<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<-]>>>>>>>>>>
+[<<<<<<<<<<+>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>+>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<
+<<<<<<<+>>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<
+<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>
+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>
+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>
+>>>>>>>>>>>>>>>>>-]<[-]<<<<<<<<<<<<<<<<[-]<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<
++<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>
++<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>
+>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>
+>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>
+>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]
+>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+
+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>
++<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>
+>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+
+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>
+>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>
+>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++++++++++++++
+++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<
+<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<
+<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>
+>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>++++++++++++
+++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>
+>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+
+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++++++
+++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>+++++++++++++++++++++++++++++++++++++++++
++++++++.[-]<<<<<<<<<<[-]<<<<<[-]<++++[>++++++++<-]>.<<<<<<<<<<<[-]>>[<<+>>>>>>>>
+>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<<[-]>>[<<+>>>>>>>>>+<<<<<<<-]>>
+>>>>>[<<<<<<<+>>>>>>>-]>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]>[-]>[-]>[-]>[-]>[-
+]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>
+>>>>>>>>>+>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<+>
+>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>
+>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>>>
+>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>>>
+>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<[
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+
+>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<
+<<<<<<<<<<<<<[>>>>>>>>>+>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<+>+
+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<
+<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<
+<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<
+<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<<-]>>>>>>[<<<<<
+<+>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<[>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>-]<<<<+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<
+<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<
+<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<
+<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+
+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>+>+<<<<<<<<<<<-]>>>>>>>>>>
+>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]
+]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+
+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<
+-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<
+<<+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<
+[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+
+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>
+>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<
++>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+
+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<
+<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>
+>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>
+>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]
+>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>
+>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>
+>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++++++++++++
+++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<
+<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<
+<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>
+>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>++++++++++
+++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>
+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<
+<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++++
+++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>+++++++++++++++++++++++++++++++++++++++
++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]<++++[>++++++++<-]>.<<<<<<<<<<<[-]>>[<<+>>>>>>
+>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<<[-]>>[<<+>>>>>>>>>+<<<<<<<-]
+>>>>>>>[<<<<<<<+>>>>>>>-]>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>
+>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<+>>>>
+>>>>>-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<
+<<<<<<<<<<<<<<<<<[>>>>>>>>>+>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<
++>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>
+>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>
+>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>
+>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<
+<+>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<<<<<<<<<<[>>>>>>>>>+>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<+
+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<
+<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<
+<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<<<<<<
+-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>+>+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<
+<<<<<+>>>>>>>>>>>-]<<<<+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<
+<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<
+<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+<<<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<
+<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<
+<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<
+<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>+>+<<<<<<<<<<<-]>>>>>>>>
+>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[
+-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
+<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+
+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>
+>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<
+<<<<+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-
+]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<
+<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>
+>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<
+<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-
+<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<
+<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>
+>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<
++>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+
+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>
+>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]
+>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++++++++++
+++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<
+<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+
+<<<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]
+]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>++++++++
+++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<
++>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<
+<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++
+++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>+++++++++++++++++++++++++++++++++++++
++++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]++++++++++.[-]<-[>--<-------]>++<<<<<<<<<<<<
+<<<[-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[-]++++++++
++++++++++>[-]+>[-]<<<<<<<<[-]>>>>>>>>>>>>>>>>>>>++++++++++[<<<<<<<<<<<<<<<<<<<++
++++++++++>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<+>[-]+++++++++++++++++>[-]+>[-]
+<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>
+>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<
++>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>
+-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<
+-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>>>[-]+>[-]<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>>>>>>>>>>>>>>[-]<<
+<<<<<<<<<<<<<<<<<+[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<
+<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<
+<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<
+<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<
+<<<<<+>>>>>>>>>>>>>>>>>>>>>-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<
+<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<+
+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>
+>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>>
+>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>>
+>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<
+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>
+>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-
+<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>
+>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>
+>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>
+>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<
+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>
+>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]<<<<+>>[->[->]
+<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>
+>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>
+>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[
+<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<
+<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-
+]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>
+>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]
+<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]
+>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>
+>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>
+>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>
+>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>
+>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<
+<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-
+]<<<<+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]
+>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>
+>>>>>>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>
+>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>
+>>>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<
+<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>
+>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]
+<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<[-]>[-]>[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<[
+-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<
+<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>
+>>>-]>>>>>>>[-]++++++++++[>>>>>>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]
+<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>>>[<<<<<<<
+<<<<+>>>>>>>>>>>-]<<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<
+<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>>+++++++++++++++++++++++++>++++++<<<<<<]
+>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-
+[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[
+-]>[-]>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>
+>[>>>>>>>+<<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>+++++++++++++++++++++++++>
+>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>
+>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>>>+<<<<-]<++
+++++++++>>>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<
+<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++
+++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<
+<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-
+]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<
+<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>++++++++++++++++++++++++
++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+
+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>
+>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<
+<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>
+>>>>>[>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<
+<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>
++<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++++++++++++++++++++++++
++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<
+<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+
+<<<<<<-]>>>>>>>[>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[
+-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>
+>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>[<<<<<
+<<<<<+<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>+++++++++++++
++++++++++++++++++++++++++++++++++++.<<<<<<<<<[-]]>>>>>>>>>[-]>[<<<<<<<<<<<+<<<<<
+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>
+>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>+++++++++++++++++++
++++++++++++++++++++++++++++++.<<<<<<<<<<[-]]>>>>>>>>>>[-]>[<<<<<<<<<<<<+<<<<<<+>
+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>
+>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>+++++++++++++++++
++++++++++++++++++++++++++++++++.<<<<<<<<<<<[-]]>>>>>>>>>>>[-]>[<<<<<<<<<<<<<+<<<
+<<<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>+++++++
++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<[-]]>>>>>>>>>>>>[-]>[<<<<<
+<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>
++<<<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>
+>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<[-]]>>>
+>>>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<<
+<[-]<<<<<[-]<++++[>++++++++<-]>.<<<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>-]<<<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<[-]>>>>>
+>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>
+>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>[<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>+<<<<<
+<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<
+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<<<<<
+<<<<<<<-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]>[-]>[-]>[-]>[-]>[-
+]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>
+>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<+>>[->[->]<<]<[-
+<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>
+[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>[<<<<
+<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[<<+<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<
+<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>
+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<-]>
+>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>
+>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>
+>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>
+[-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<
++<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<
+<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<
+<<<<<[-]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<
+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<
+<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]
+>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>
+>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+>+<<<<<
+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>
+>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>
+>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>
+-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>
+>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>>>>
+>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+>
+>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<
+<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>
+>>>>>>>>>>>>>>>>-]<<<<+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>>>>>>>>>>>>>>>+
+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>>>-]<<<<<<<<
+<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<
+<<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<
+<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[-]>[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<
+<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>
+>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<<
+<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<<<[-]>>>>[-]]<<<<[>>>>>>>>>
+>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>>>>
+>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>
+>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<[-]>>>>>>>>>>
+>>>>>>>>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<
+<<<<<<+>>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>
+>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>+>+<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<+>>[->[->]<<]<[-<+>>]<[-]>>[-]>[-]<<<<[>>>>
+>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<+>>>>>>>>
+>>>>>>>>>-]<<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<+<+>>>>>>>>>>>>
+>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<<<<[-]]]<[-]>>>>>>>>>>>>>>>>>>[<<+<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>
+>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
+>>>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>
+>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]>>>>>[-]>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>
+>>>>>>>>>>>>>>+>+<<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>-]<<<<<+>+>>[->[->]<<]<[-<->>]<[-]>>[-]>[<<
+<<[-]>>>>[-]]<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>[<<<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[[-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<
+<<<<<<<<<+<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<<<<<-]>[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<[-]]]>>>>>>>>>>>>>>>>>>[-]<<<<<
+<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>-]>[-]<<<<<<<<<<<<<<<<<[-]<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>>
+>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<
+<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>>>-]>>>>>>>[-]++++++++++[>>>>>>>>>>>>>[>+<-]<[>
++<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-
+]>>[-]>[-]>[-]>[-]>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<<[->-[>+>>]>[+[-<+>]
+>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>>+++++++
+++++++++++++++++++>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-
+]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<
+<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<<<<<<<<<<[->
+-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>
+[->>>>+++++++++++++++++++++++++>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<+
++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>
+>>>>>>+<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<
+<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<
+-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<
+<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[
+-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<
+<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]
+>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<
+<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]
+>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<
+<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+
+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++++++++++++++++++++++++++++++++
++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>
+>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>
+>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<
+<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[
+>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>+++++++++++++++++++++++++
++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-
+]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<
+<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++++++++++++++++++++++++++++++++++++++++++++++
++.<<<<<<<<[-]]>>>>>>>>[-]>[<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<
+-]>>>>>>>[>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<[-]
+]>>>>>>>>>[-]>[<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<[>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>
+>>[>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<[-]]>>>>
+>>>>>>[-]>[<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>
+>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>
+>>>[>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<[-]]>
+>>>>>>>>>>[-]>[<<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<[>>>
+>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<
+<<<-]>>>>>>>[>>>>>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<
+<<<<<<[-]]>>>>>>>>>>>>[-]>[<<<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]
+<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++
++++++++++++.<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>[-]>++++++++++++++++++++++++++++++++++
+++++++++++++++.[-]<<<<<<<<<<<<<<<[-]<<<<<[-]++++++++++.
\ No newline at end of file
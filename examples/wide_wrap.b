@@ -0,0 +1,306 @@
+>>>>>>>+++++<<<+++++++[>>>>>>>>>+>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>[<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>>+<<[->[>-]>[->>+<]<+<-
+<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->[>-]>[->>+<]<+<-<]>[<<<<<<<+>>>>>>>-]>->>[>>+<<
+-]<<<<<<<<<<<<[>>>>>>>>+>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<<<+>>>>>>>
+>>>>>>-]<<<<<[<<<<<->>>>>-]>>>>>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>
+>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<+<<<
+<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<<
+<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>
++>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>
++++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++
+++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>
++<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>
++>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++
+++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++
+++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<
+<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>
+>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<
+<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++++++++++++++++++++++++++++++++++++++
+.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<
+<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>++++++
+++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+
+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>
+>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>++++++++++++++++++++++++++++++++++++
+++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<
+<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<
+<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<[
+-]]>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<[-]
+<<<<<[-]++++++++++.[-]>[-]>[-]>[-]>[-]<<<<++++++++[<++++++++++++++>-]<<<<<<<[>>>
+>>>>+<<<<<<<-]>>>>>>>>+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>
+-]>[->>+<]<+<<]>[<<<<<<<+>>>>>>>-]>->>[>>+<<-]<<<++++[<++++>-]<+[<<<<<+>>>>>-]>>
+>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>
+>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>
+>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[
+-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>
+>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>+
++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>
+-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++
+++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>
+>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>+++
++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]
+<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>
++<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>
+>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>
+>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<
+<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<
++>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++++++++++++++++++++++++++++++++
++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<
+<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]
+>>>>>>>[>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>
+>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<
+<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++++++
++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>++++++++++++++
+++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]++++++++++.<<<<<<<[-]
+------------------------>[-]+++>>>>>>>>>>>>>>>>>>+++++++[<++++++++++>-]>>++++[>+
++++<-]>[<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>[<<<<<<<<+>>>>>+>>>-]<<<[>>
+>+<<<-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]
+<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]>>>>>[<<<<<<<<<+>>>>>+
+>>>>-]<<<<[>>>>+<<<<-]<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>[>>>+<<<-]<<<<[-]>[-]>>>>
+>>>>>[<<<<<<<<<<<<+>>>>>+>>>>>>>-]<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<<<<<+>
+>>>>>>>>>>-]<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>
+-]>[->>+<]<+<<]>[>>>>>>>>>>>+<<<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>[<<<<<<<<<<<<<+>>
+>>>+>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<
+<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<
+<]>[>>>>>>>>>>>>+<<<<<<<<<<<<-]>->>[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[-
+<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<[>>>>>>+>>>>>+<<<<<<<<<<
+<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[->+[>-]>[
+->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<<<<<<<-]>
+->>[>>+<<-]<<<<<<<<<[>>>>>+>>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]<
+<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>[>>>+<<<-]>>>>>>>>>>>]<-]<<<<<<<<<<<<<<<<<<<<<<[
+-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<[-]>>>>>>>>>>>>>>[<
+<<<<<<<<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<[-]<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<-
+]>>>>>>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]
+>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>
+>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<
+]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++
+++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+
+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<
+++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<
+]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>
+>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>
+>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[
+>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<
+<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>
+>>>[>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<
+<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<
+<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++++++++++++++++++++++++++
++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<
+<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<
+<<<<-]>>>>>>>[>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]
+]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<
+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+
++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>++++++++
+++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]++++++++++.<<<<
+<<<<[-]+++++++++>[-]+>[-]>>>>>>[-]>[-]>[-]>[-]>[-]<<<<<<<<<<<<[>>>>>>>+>>>>>+<<<
+<<<<<<<<<-]>>>>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>+<<<<<<<-]
+>>>>>>>>+<<[->[>-]>[->>+<]<+<-<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->[>-]>[->>+<]<+<-<
+]>[<<<<<<<+>>>>>>>-]>->>[>>+<<-]>>[<<<<<<<<<<<->>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>
+>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<+<<
+<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>[-]+++++[>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<
+<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[
+>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>
+>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<+++++
++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>
+>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[
+>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>++
++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<+++++++
++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<
+<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>
+>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<
+<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++++++++++++++++++++++++++++++++++++++++++
++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<
+<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++
++++++++++++++++++++++++++++++++++++++++++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<
++>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+
+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>+++++++++++++++++++++++++++++++++++
++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<
+<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<<
+[-]]>>>>>>>>[-]>++++++++++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<[-
+]<<<<<[-]++++++++++.<<<<<<<[-]>[-]>>>>>>>>>>>>>>>>>>>>>>>[-]+[->,[+[-----------[
+--------------------------------------<<<<<<<[-]++++++++++>[-]>>>[-]++++++++++++
+++++[<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>[<<<<<<<<+>>>>>+>>>-]<<<[>>>+<
+<<-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<
+<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]>>>>>[<<<<<<<<<+>>>>>+>>>
+>-]<<<<[>>>>+<<<<-]<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>[>>>+<<<-]<<<<[-]>[-]>>>>>>>
+>>[<<<<<<<<<<<<+>>>>>+>>>>>>>-]<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>>[<<<<<<<<<<<+>>>>
+>>>>>>>-]<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>
+[->>+<]<+<<]>[>>>>>>>>>>>+<<<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>[<<<<<<<<<<<<<+>>>>>
++>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<
+<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>
+[>>>>>>>>>>>>+<<<<<<<<<<<<-]>->>[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[-<<<
+<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>
+>>+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>[<<<<<<<
++>>>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->
+>+<]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+
+>>>>>+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]<<<<
+<[>>>>>>>>>+<<<<<<<<<-]>>>>>>[>>>+<<<-]>>>>>>>>>>>]<-]>>>>[-]<<<<<<<<<<<<[>>>>>>
+>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]<<<
+<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>
+>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<
+<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>
+[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<
+<<<<-]>->>[>>+<<-]>>[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>>>>>>>>>[-]<+>]]]<]<<
+<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>
+>>>>+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]<<<<<<<<<
+<<[>>>>>>>+<<<<<<<-]>>>>>>>>+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<
+[->+[>-]>[->>+<]<+<<]>[<<<<<<<+>>>>>>>-]>->>[>>+<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<
+<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<
+<<<<<<-]<<<<<[<<<<<+>>>>>-]>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]>>>>>>>>>>>>>>[-]>[-]
+<<<<<<<<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>
+-]<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<-]>>>>>[<<<<<+>>>>>-]>>>>>>>[-]+++++[>>>>>
+>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>[
+<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<
+-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>>
+>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+
+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>
+>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]
+<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>>
+>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>
+]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<<
+<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<
+<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>++++++++++++
+++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>>
+>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<
+[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<
+<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>>
+>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>
+++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<<
+<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>>
+>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>++++++++++++++++++++++
+++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>+++++++++++++++++++++++++++++
++++++++++++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]++++++++++.>>>>>>>>>>>>>>>>>[-]+[->,
+[+[-----------[--------------------------------------<<<<<<<[-]++++++++++>[-]>[-
+]>[-]>[-]<++++[>++++++++<-]>[<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>[<<<<<
+<<<+>>>>>+>>>-]<<<[>>>+<<<-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>
+>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]>
+>>>>[<<<<<<<<<+>>>>>+>>>>-]<<<<[>>>>+<<<<-]>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<+<<[->
++[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>+<<
+<<<<<<-]>->>[>>+<<-]>>>>>>[<<<<<<<<<<+>>>>>+>>>>>-]<<<<<[>>>>>+<<<<<-]>>>>>[<<<<
+<<<<<+>>>>>>>>>-]<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->
++[>-]>[->>+<]<+<<]>[>>>>>>>>>+<<<<<<<<<-]>->>[>>+<<-]>>>>>>>[<<<<<<<<<<<+>>>>>+>
+>>>>>-]<<<<<<[>>>>>>+<<<<<<-]<<<<<[>>>>>>>>>>>+<<<<<<<<<<<-]>>>>>>[>>>>>+<<<<<-]
+<<<<[-]>[-]>>>>>>>>>[<<<<<<<<<<<<+>>>>>+>>>>>>>-]<<<<<<<[>>>>>>>+<<<<<<<-]>>>>>>
+>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>
+>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>+<<<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>[<
+<<<<<<<<<<<<+>>>>>+>>>>>>>>-]<<<<<<<<[>>>>>>>>+<<<<<<<<-]>>>>>>>>[<<<<<<<<<<<<+>
+>>>>>>>>>>>-]<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+
+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>+<<<<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>>[<<<<<<<<<<<
+<<<+>>>>>+>>>>>>>>>-]<<<<<<<<<[>>>>>>>>>+<<<<<<<<<-]>>>>>>>>>[<<<<<<<<<<<<<+>>>>
+>>>>>>>>>-]<<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[
+>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>>>[<<<<<<<<<
+<<<<<<+>>>>>+>>>>>>>>>>-]<<<<<<<<<<[>>>>>>>>>>+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]
+<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>->>[>>>>>>>>>>>>>+<
+<<<<<<<<<<<<-]>>>>>>>>>>>>>[-<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>>>>>>
+>>>>>>>[<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>>+<<<<<<<<<<<<<<<-]>>>[<<<<<<<+>>>>>>>-]<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<
+<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>+<<<<<<<-]>->>[>>+<<-]>>>>>>>>
+>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>
+>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<+<<[->+[>-]>[->>+<]<+
+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>+<<<<<<<<-]>->>[>>
++<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>-]<<<<<<<<
+<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<
+<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>
+>>>>>>+<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+
+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]<<
+<<<[>>>>>>>>>>>+<<<<<<<<<<<-]>>>>>>[>>>>>+<<<<<-]>>>>>>>>>>>]<-]>>>>[-]<<<<<<<<<
+<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<
+<<<<<-]>>>>>>>>>>>>>[-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]>>>>>>>>>>>>>[-]<
+<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<<<<<<<<-]<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>>
+>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>-]<<<<
+<<<<<<<<<<<<<<+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+
+<]<+<<]>[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>->>[>>+<<-]>>>>>>>>>>>>>>>>>[
+<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<+>>>>[<<<<<<+>>>>>
+>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-]>->>[
+>>+<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>>>>>>>>>>>>>>>>>>>>-]<<<<<<<<<
+<<<<<<<<<<<+>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[>>>>>>>>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<<<<<<<<-]>->>[>>+<<-]>>[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>
+>>>>>>>>>>>[-]<+>]]]<]<<<<<<<<<<<<<<<<<<[-]>[-]>[-]>[-]>[-]>[-]>[-]>>>>>>>>>>>>>
+>[<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<
+<<<<<<<<<<<<<-]<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>+<<<<<<<<<<<<<<-]>>>>>>>>>>>>>>>
++<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[<<<<<
+<<<<<<<<<+>>>>>>>>>>>>>>-]>->>[>>+<<-]>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<+>>
+>>>+>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]<<<<<<
+<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>>>>>>>>>+<<[->+[>-]>[->>+<]<+<<]>
+>>>>>[<<<<<<+>>>>>>-]<<<<<<[->+[>-]>[->>+<]<+<<]>[<<<<<<<<<<<<<+>>>>>>>>>>>>>-]>
+->>[>>+<<-]>>>>>>>>>>>>>>>>>>[<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>-]<<
+<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]<<<<<<<<<<<<<<<<[>>>>>>>>>>
+>>+<<<<<<<<<<<<-]>>>>>>>>>>>>>+<<[->+[>-]>[->>+<]<+<<]>>>>>>[<<<<<<+>>>>>>-]<<<<
+<<[->+[>-]>[->>+<]<+<<]>[<<<<<<<<<<<<+>>>>>>>>>>>>-]>->>[>>+<<-]>>>>>>>>>>>>>>>>
+>>>[<<<<<<<<<<<<<<<<<<<<<<<+>>>>>+>>>>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<[>>>>>>>
+>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]<<<<<[<<<<<<<<<<+>>>>>>>>>>-]>>>>>>[<<<<<<<<<<<<
+<<<<+>>>>>>>>>>>>>>>>-]>>>>>>>>>>>>>>[-]>[-]>[-]>[-]<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<<<<<<<<-]>>>>>>>>>>>>>[<<<<<<<<<<<
+<<+>>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<+<<<<<<<<<<<<-]>>>
+>>>>>>>>>[<<<<<<<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<
+<+<<<<<<<<<<<-]>>>>>>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<<<<<<<[>>>>>>>>>>>>>>>>>
+>>>>+<<<<<<<<<<<+<<<<<<<<<<-]>>>>>>>>>>[<<<<<<<<<<+>>>>>>>>>>-]>>>>>>>[-]+++++++
++++[>>>>>>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<[>+<-]<
+<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]>>>>>>[<<<<<<<<<<<+>>>>>>>>>>>-]<<<<
+<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>>>>>>>+<<<<
+<<<<<<-]>>>>[->>>>>+++++++++++++++++++++++++>++++++<<<<<<]>>>>>>[<<<<<<+>>>>>>-]
+<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<
+<<<]>[-]>>[>>>>>>>>+<<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>>>[<<<<<<<<<<
++>>>>>>>>>>-]<<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>
+>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>>+++++++++++++++++++++++++>>++++++<<<<<<]>>>>>>[<
+<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>>]>[
++[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>>+<<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]>>>>
+[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<
+<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<<]>>
+>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>
++>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]>[-]
+>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-
+]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]>>>>
+>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-[>+>
+>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>-]<<
+<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<<<<<
+<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++++++
++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>>>>>
+>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<
+<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.
+<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>>>>>
+>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>
+>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<<<<<
+<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]>>>>
+>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++++++++++++++++++++
++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>[<<<<<<<<<<+<<<<<<+>>>>>>>>>
+>>>>>>>-]<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>
+>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>+++++++++++++++++++++++++++++++++++
++++++++++++++.<<<<<<<<<[-]]>>>>>>>>>[-]>[<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>-]<
+<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<
+<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>+++++++++++++++++++++++++++++++++++++++++
++++++++.<<<<<<<<<<[-]]>>>>>>>>>>[-]>[<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>-]<<<
+<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]
+<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>+++++++++++++++++++++++++++++++++++++++
++++++++++.<<<<<<<<<<<[-]]>>>>>>>>>>>[-]>[<<<<<<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>>>>>
+>-]<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<
++>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>+++++++++++++++++++++++++++++
++++++++++++++++++++.<<<<<<<<<<<<[-]]>>>>>>>>>>>>[-]>[<<<<<<<<<<<<<<+<<<<<<+>>>>>
+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<<<<<<-
+]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>>>>>>+++++++++++
++++++++++++++++++++++++++++++++++++++.<<<<<<<<<<<<<[-]]>>>>>>>>>>>>>[-]>++++++++
+++++++++++++++++++++++++++++++++++++++++.[-]<<<<<<<<<<<<<<<[-]<<<<<[-]++++++++++
+.<<<<<<[-]<,[>>>>>>>>>>>>>>+<<<<<<<<+<<<<<<-]>>>>>>[<<<<<<+>>>>>>-]>>>>>>>+++++[
+>>>>>>>>[>+<-]<[>+<-]<[>+<-]<[>+<-]<<<<<<<<<<<[-]++++++++++<[-]>>[-]>[-]>[-]>[-]
+>>>>[<<<<<<<<<+>>>>>>>>>-]<<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<
+<<<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>>+++++++++++++++++++++++++>>>++++++<<<<<
+<]>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[-
+>-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>>+<<<<<<-]<[>>>>+<<<<-]<++++++++++>>>[-]
+>[-]>>>[<<<<<<<<+>>>>>>>>-]<<<<<<<<[->-[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<
+<<<-]<[>>>>>>>>>>+<<<<<<<<<<-]>>>>[->>+++++++++++++++++++++++++>>>>++++++<<<<<<]
+>>>>>>[<<<<<<+>>>>>>-]<<<<<<<<<<<++++++++++>>>[-]>[-]>[<<<<<<+>>>>>>-]<<<<<<[->-
+[>+>>]>[+[-<+>]>+>>]<<<<<]>[-]>>[>>>>>+<<<<<-]<[>>>>+<<<<-]>>>>[>>>>>>+<<<<<<-]>
+-]<<<<<<<[-]>>>>>>>>>>>>[<<<<<<+<<<<<<+>>>>>>>>>>>>-]<<<<<<<<<<<<[>>>>>>>>>>>>+<
+<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>+++++++
++++++++++++++++++++++++++++++++++++++++++.<<<<<[-]]>>>>>[-]>[<<<<<<<+<<<<<<+>>>>
+>>>>>>>>>-]<<<<<<<<<<<<<[>>>>>>>>>>>>>+<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<
+<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>+++++++++++++++++++++++++++++++++++++++++++++
++++.<<<<<<[-]]>>>>>>[-]>[<<<<<<<<+<<<<<<+>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<[>>>>>>>>
+>>>>>>+<<<<<<<<<<<<<<-]>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>
+>>>>>++++++++++++++++++++++++++++++++++++++++++++++++.<<<<<<<[-]]>>>>>>>[-]>[<<<
+<<<<<<+<<<<<<+>>>>>>>>>>>>>>>-]<<<<<<<<<<<<<<<[>>>>>>>>>>>>>>>+<<<<<<<<<<<<<<<-]
+>>>>>>[>+<<<<<<<+>>>>>>-]<<<<<<[>>>>>>+<<<<<<-]>>>>>>>[>>>>>>>>+++++++++++++++++
++++++++++++++++++++++++++++++++.<<<<<<<<[-]]>>>>>>>>[-]>++++++++++++++++++++++++
+++++++++++++++++++++++++.[-]<<<<<<<<<<[-]<<<<<[-]++++++++++.
\ No newline at end of file